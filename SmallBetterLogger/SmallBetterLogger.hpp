@@ -34,7 +34,7 @@ SOFTWARE.
 #define SBLOGGER_LEVEL_CRITICAL  5
 #define SBLOGGER_LEVEL_OFF       6
 //
-// Define your preferred active level (e.g. using the macro bellow), or use the static method Logger::SetLoggingLevel(const LOG_LEVELS& level)
+// Define your preferred active level (e.g. using the macro bellow), or use the static method Logger::SetLoggingLevel(const LogLevel& level)
 //
 //#define SBLOGGER_LOG_LEVEL SBLOGGER_LEVEL_TRACE
 
@@ -52,9 +52,25 @@ SOFTWARE.
 	#if __cplusplus <= 201703L
 		// For formatting dates to string pre C++20
 		#define SBLOGGER_OLD_DATES
+	#else
+		// Standard libraries without time zones or std::format (e.g. libstdc++ before 13) also format dates using the pre C++20 methods
+		#include <version>
+		#if !defined __cpp_lib_format || !defined __cpp_lib_chrono || __cpp_lib_chrono < 201907L
+			#define SBLOGGER_OLD_DATES
+		#endif
 	#endif
 #endif
 
+// For C++20 compilers, check the message format strings at compile time (using consteval)
+#if defined __cpp_consteval && !defined SBLOGGER_LEGACY
+	#define SBLOGGER_CONSTEVAL_FORMATS
+#endif
+
+// Maximum number of segments (literal text followed by a placeholder) precomputed for a format string, longer ones are parsed when written
+#ifndef SBLOGGER_MAX_FORMAT_SEGMENTS
+	#define SBLOGGER_MAX_FORMAT_SEGMENTS 16
+#endif
+
 // Detect OS and set the appropriate macros
 #if macintosh || Macintos
 	#define SBLOGGER_OS9
@@ -62,6 +78,25 @@ SOFTWARE.
 	#define SBLOGGER_NIX
 #endif
 
+// Hint the compiler that a condition (e.g. a log level check) is usually false, keeping the code it guards out of the common path
+#if defined __GNUC__ || defined __clang__
+	#define SBLOGGER_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#else
+	#define SBLOGGER_UNLIKELY(x) (x)
+#endif
+
+// Discard the branch not taken at compile time, when "if constexpr" is available (otherwise relying on the compiler to remove it, the condition being constant)
+#ifdef SBLOGGER_LEGACY
+	#define SBLOGGER_IF_CONSTEXPR(x) if (x)
+#else
+	#define SBLOGGER_IF_CONSTEXPR(x) if constexpr (x)
+#endif
+
+// Detect if the CPU time stamp counter (TSC) can be used as a clock source
+#if defined __x86_64__ || defined __i386__ || defined _M_X64 || defined _M_IX86
+	#define SBLOGGER_TSC
+#endif
+
 // Cross-platform newline macros
 #ifdef SBLOGGER_NIX
 	#define SBLOGGER_PATH_SEPARATOR '/'
@@ -83,10 +118,17 @@ SOFTWARE.
 // Used for formatting and creating the output string
 #include <sstream>
 #include <vector>
-// Used for modf function
-#include <cmath>
+#include <deque>
+// Used for merging the per-thread queues of AsyncLogger by time
+#include <algorithm>
+// Used for selecting between runtime and compile-time message formats
+#include <type_traits>
+// Used for converting arguments (e.g. std::snprintf for floating point values pre C++17)
+#include <cstdio>
 // Used for str* functions
 #include <cstring>
+// Used for character classification when compiling formats
+#include <cctype>
 
 // Used for processing using time such as timed file logs and date formatting (if SBLOGGER_LEGACY is not defined)
 #include <chrono>
@@ -94,6 +136,34 @@ SOFTWARE.
 // Used for asynchronous operations such as changing files for timed file logs
 #include <thread>
 #include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+// Used for the tasks run by the shared scheduler
+#include <functional>
+// Used for the dictionary of the messages written to binary log files
+#include <unordered_map>
+// Used for the fixed size integers of the compressed file formats
+#include <cstdint>
+
+// Used for writing to the standard streams and files through their file descriptors (POSIX systems)
+#ifdef SBLOGGER_NIX
+#include <unistd.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/uio.h>
+#endif
+
+// Used for lowering the priority of the thread compressing files (Linux)
+#ifdef __linux__
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#endif
+
+// Define the "SBLOGGER_ZLIB" macro (and link with zlib) to compress files using gzip
+#ifdef SBLOGGER_ZLIB
+#include <zlib.h>
+#endif
 
 // For pre C++17 compilers define the "SBLOGGER_LEGACY" macro, to replace <filesystem> operations with regex and other alternatives
 #ifdef SBLOGGER_LEGACY
@@ -102,12 +172,28 @@ SOFTWARE.
 #else
 // Used for file path checking and file manipulation
 #include <filesystem>
+// Used for converting numeric arguments without streams (std::to_chars)
+#include <charconv>
+// Used for writing std::string_view arguments
+#include <string_view>
 #endif
 
-// For formatting dates to string pre C++20
-#ifdef SBLOGGER_OLD_DATES
-// Make use of std::strftime
+// Make use of std::strftime (and std::localtime alternatives) for formatting dates to string
 #include <ctime>
+
+// Used for formatting dates to string using std::chrono::zoned_time (C++20 or later)
+#ifndef SBLOGGER_OLD_DATES
+#include <format>
+#include <iterator>
+#endif
+
+// Used for reading the time stamp counter (when used as a clock source)
+#ifdef SBLOGGER_TSC
+	#ifdef _MSC_VER
+		#include <intrin.h>
+	#else
+		#include <x86intrin.h>
+	#endif
 #endif
 
 // For pre C++17 compilers define the "LEGACY" macro, to replace <filesystem> operations with regex and other alternatives
@@ -142,6 +228,54 @@ namespace sblogger
 	class DailyLogger;
 	using daily_logger = DailyLogger;
 
+	// Rotating File Logger
+	// Used to log messages to a file stream, renamed (keeping a limited number of previous files) once it reaches a specified size
+	class RotatingFileLogger;
+	using rotating_file_logger = RotatingFileLogger;
+
+	// Async Logger
+	// Used to log messages through another logger, which writes them from a background thread
+	class AsyncLogger;
+	using async_logger = AsyncLogger;
+
+	// Binary Log Reader
+	// Used to read the files written by FileLoggers in binary mode, formatting their messages as text
+	class BinaryLogReader;
+	using binary_log_reader = BinaryLogReader;
+
+	//
+	// Call sites' declaration
+	//
+
+	// Call Site Registry
+	// Used to enable or disable the call sites of the logging macros at runtime (by file, function or level)
+	class CallSiteRegistry;
+	using call_site_registry = CallSiteRegistry;
+
+	//
+	// Formatters' declaration
+	//
+
+	// Formatter
+	// Appends the text representation of a T value to the output of a log (specialize it for your own types)
+	template<typename T, typename = void>
+	struct Formatter;
+	template<typename T>
+	using formatter = Formatter<T>;
+
+#ifndef SBLOGGER_LEGACY
+	//
+	// Format strings' declaration
+	//
+
+	// Format String
+	// Message format whose placeholders are checked (C++20) and split into segments at compile time
+	template<typename ...T>
+	class FormatString;
+	template<typename ...T>
+	using format_string = FormatString<T...>;
+#endif
+
 	//
 	// Custom exceptions' definition
 	//
@@ -170,6 +304,16 @@ namespace sblogger
 	class TimeRangeException;
 	using time_range_exception = TimeRangeException;
 
+	// SizeRangeException
+	// Thrown when a size related value is out of bounds (e.g.: a maximum file size of 0)
+	class SizeRangeException;
+	using size_range_exception = SizeRangeException;
+
+	// InvalidBinaryLogException
+	// Thrown when a binary log file cannot be read (e.g.: it is not a binary log or it was written on a system with a different byte order)
+	class InvalidBinaryLogException;
+	using invalid_binary_log_exception = InvalidBinaryLogException;
+
 	//
 	// Enum definitions
 	//
@@ -188,6 +332,60 @@ namespace sblogger
 	};
 	using stream_type = StreamType;
 
+	// Clock sources used to timestamp messages (the ones not available on a platform fall back to SYSTEM)
+	enum class ClockType
+	{
+		SYSTEM, REALTIME_COARSE, TSC
+	};
+	using clock_type = ClockType;
+
+	// Behaviours of an AsyncLogger whose queue is full
+	enum class OverflowPolicy
+	{
+		BLOCK, DROP_NEWEST, OVERWRITE_OLDEST, DROP_BELOW_LEVEL
+	};
+	using overflow_policy = OverflowPolicy;
+
+	// Queues used by an AsyncLogger (a single shared queue, or one for each thread writing to it, merged by time)
+	enum class QueueMode
+	{
+		SHARED, PER_THREAD
+	};
+	using queue_mode = QueueMode;
+
+	// Compression of the files closed by rotating loggers (GZIP is only available if "SBLOGGER_ZLIB" is defined, LZ4 being used otherwise)
+	enum class Compression
+	{
+		NONE, LZ4, GZIP
+	};
+	using compression = Compression;
+
+	// Runtime states of the call sites of the logging macros
+	enum class CallSiteState : unsigned char
+	{
+		UNREGISTERED,	// The call site was not reached yet
+		DEFAULT,		// Messages are written if their level is enabled
+		ENABLED,		// Messages are always written, regardless of the logging level
+		DISABLED		// Messages are never written
+	};
+	using call_site_state = CallSiteState;
+
+	//
+	// Call sites
+	//
+
+	// Static information about a place messages are logged from, created once by each logging macro (its address identifies the call site)
+	struct CallSite
+	{
+		const char* file;		// Path of the source file, as given by __FILE__
+		const char* fileName;	// Name of the source file (computed at compile time)
+		unsigned int line;
+		const char* function;
+		LogLevel level;			// Level of the logging macro (TRACE for SBLOGGER_WRITE and SBLOGGER_WRITELINE)
+		mutable std::atomic<CallSiteState> state;	// Set by the CallSiteRegistry when the call site is first reached
+	};
+	using call_site = CallSite;
+
 	//
 	// Custom exceptions
 	//
@@ -340,1387 +538,7538 @@ namespace sblogger
 	{ }
 
 	//
-	// Classes' definitions
+	// SizeRangeException
 	//
 
-	// Abstract class which implements basic logger methods and members (ex.: auto flush, format, replace formatters etc)
-	class Logger
+	// Thrown when a size related value is out of bounds (e.g.: a maximum file size of 0)
+	class SizeRangeException : public SBLoggerException
 	{
-	protected:
+	public:
 		//
-		// Protected members
+		// Constructors and destructors
 		//
 
-		std::string m_Format;
-		bool m_AutoFlush;
-		size_t m_IndentCount;
-		static LogLevel s_CurrentLogLevel;
-
-		//
-		// Protected constructors
-		//
+		// Default constructor
+		SizeRangeException();
+	};
 
-		// Initialize a logger, with a format, auto flush (by default)
-		Logger(const std::string& format, bool autoFlush);
+	//
+	// Constructors and destructors
+	//
 
-		// Initialize a logger, with no format, auto flush (by default)
-		Logger(bool autoFlush) noexcept;
+	// Default constructor
+	inline SizeRangeException::SizeRangeException()
+		: SBLoggerException("Size value not in the allowed interval.")
+	{ }
 
-		// Copy constructor
-		Logger(const Logger& other) noexcept;
+	//
+	// InvalidBinaryLogException
+	//
 
+	// Thrown when a binary log file cannot be read (e.g.: it is not a binary log or it was written on a system with a different byte order)
+	class InvalidBinaryLogException : public SBLoggerException
+	{
+	public:
 		//
-		// Protected methods
+		// Constructors and destructors
 		//
 
-		// Writes string to appropriate stream
-		virtual void writeToStream(const std::string& message) = 0;
-
-		// Converts a T value to a string to be used in writing a log
-		template<typename T>
-		std::string stringConvert(const T& t) const noexcept;
+		// Creates an invalid binary log exception, giving the reason the log cannot be read
+		InvalidBinaryLogException(const std::string& reason);
+	};
 
-		// Adds ANSII colour codes if current stream supports them
-		// (The Logger base class does not do anything with the message, the method needing implementation from derived classes)
-		virtual void addColours(std::string& message) const noexcept;
+	//
+	// Constructors and destructors
+	//
 
-		// Add indent to string (if it is set)
-		void addIndent(std::string& message) const noexcept;
+	// Creates an invalid binary log exception, giving the reason the log cannot be read
+	inline InvalidBinaryLogException::InvalidBinaryLogException(const std::string& reason)
+		: SBLoggerException("Cannot read binary log: " + reason + '.')
+	{ }
 
-		// Add padding to string (if padding format exists)
-		void addPadding(std::string& message) const noexcept;
+	//
+	// Implementation details (not meant to be used directly)
+	//
 
-		// Append format (if it exists) and replace all "{n}" placeholders with their respective values (n=0,...)
-		std::string replacePlaceholders(std::string message, const std::vector<std::string>& items) const noexcept;
+	namespace detail
+	{
+		// Kinds of instructions a log format is compiled into
+		enum class FormatTokenType : unsigned char
+		{
+			LITERAL, MESSAGE, LEVEL, COLOUR, SOURCE, FULL_SOURCE, LINE, FUNCTION, DATE, MILLISECONDS, MICROSECONDS, NANOSECONDS, ELAPSED
+		};
 
-		// Replaces predefined placeholders from the message (e.g. "%er" will be changed to "Error" in the final message)
-		void replacePredefinedPlaceholders(std::string& message) const noexcept;
+		// Single instruction of a compiled format: a literal run or a typed field
+		struct FormatToken
+		{
+			FormatTokenType type;
+			bool upper;		// LEVEL: use the uppercase name, COLOUR: use the bright variant
+			size_t offset;	// LITERAL/DATE: start in the text pool, COLOUR: ANSI colour code
+			size_t size;	// LITERAL/DATE: length in the text pool
+		};
 
-		// Replace current logging level in format
-		void replaceCurrentLevel(std::string& message) const noexcept;
+		// Get the name of a log level (e.g. "Error" or "ERROR")
+		const char* levelName(LogLevel level, bool upper) noexcept;
 
-		// Replace other placeholders, such as those for file, line and function related information
-		void replaceOthers(std::string& message, const char* file, const char* line, const char* function) const noexcept;
+		// Get the name of the source file found at "path" (after its last path separator, or "name" if there is none), at compile time for the logging macros
+		constexpr const char* sourceFileName(const char* path, const char* name) noexcept;
 
-		// Replace date format using std::strftime (pre C++20) or std::chrono::format
-		void replaceDateFormats(std::string& message) const noexcept;
+		// Check if "text" matches "pattern", in which '*' matches any characters and '?' a single one
+		bool matchesPattern(const char* pattern, const char* text) noexcept;
 
-	public:
-		// Default destructor
-		virtual ~Logger() = default;
+		// Check if the last argument of a log call is the call site added by the logging macros
+		template<typename ...T>
+		struct HasCallSite : std::false_type
+		{ };
+		template<typename T>
+		struct HasCallSite<T> : std::is_same<T, const CallSite*>
+		{ };
+		template<typename T, typename ...TRest>
+		struct HasCallSite<T, TRest...> : HasCallSite<TRest...>
+		{ };
 
-		//
-		// Public methods
-		//
+		// Used to stop template argument deduction (e.g. for the arguments of a format string)
+		template<typename T>
+		struct IdentityType
+		{
+			using type = T;
+		};
+		template<typename T>
+		using Identity = typename IdentityType<T>::type;
 
-		// Set the current logging level to one of the "LOG_LEVELS" options (ex.: TRACE, DEBUG, INFO etc). 
-		static void SetLoggingLevel(const LogLevel& level) noexcept;
+		// Used to detect if an expression is valid (e.g. calling a value)
+		template<typename T>
+		struct VoidType
+		{
+			using type = void;
+		};
 
-		// Get the current logging level (one of the "LOG_LEVELS" options, ex.: TRACE, DEBUG, INFO etc). 
-		static LogLevel GetLoggingLevel() noexcept;
+		// Check if T is a callable object taking no arguments (e.g. a lambda), used as an argument which is only evaluated if the message is written
+		template<typename T, typename = void>
+		struct IsLazyArgument : std::false_type
+		{ };
+		template<typename T>
+		struct IsLazyArgument<T, typename VoidType<decltype(std::declval<const T&>()())>::type> : std::is_class<T>
+		{ };
 
-		// Get the current log format
-		inline std::string GetFormat() const noexcept;
+		// Enabled for message types which are formatted at runtime (e.g. std::string or const char*, but not arrays, which are passed as a FormatString when available)
+		template<typename TMessage>
+#ifdef SBLOGGER_LEGACY
+		using EnableIfRuntimeMessage = typename std::enable_if<std::is_convertible<const TMessage&, std::string>::value>::type;
+#else
+		using EnableIfRuntimeMessage = typename std::enable_if<!std::is_array<TMessage>::value && std::is_convertible<const TMessage&, std::string>::value>::type;
+#endif
 
-		// Set the current log format to "format"
-		inline void SetFormat(const std::string& format);
+		// Literal text of a format string, followed by the index of an argument (or "NO_ARGUMENT")
+		struct FormatSegment
+		{
+			static const unsigned short NO_ARGUMENT = 0xFFFFu;
 
-		// Flush appropriate stream
-		virtual void Flush() noexcept = 0;
+			unsigned short offset;
+			unsigned short size;
+			unsigned short argument;
+		};
 
-		// Indent (prepend '\t') log, returns the number of indents the final message will contain
-		virtual size_t Indent() noexcept;
+		// Type-erased reference to an argument of a log call, which is only converted to text while writing the message
+		struct FormatArgument
+		{
+			const void* value;
+			void (*format)(std::string& output, const void* value);
+		};
 
-		// Dedent (remove '\t') log, returns the number of indents the final message will contain
-		virtual size_t Dedent() noexcept;
+		// Message text (or its precomputed segments) together with the values of its "{n}" placeholders
+		struct MessageView
+		{
+			const char* data;
+			size_t size;
+			const FormatSegment* segments;
+			size_t noSegments;
+			const FormatArgument* arguments;
+			size_t noArguments;
+			bool isStatic;	// "data" is a string literal checked at compile time, so it can be used after the call
+		};
 
-		//
-		// Generic Methods: Write a TRACE level message (depending on the specified "LOG_LEVEL") to a stream
-		//
+		// Reusable output buffer of the current thread (each nested log, e.g. made from an "operator<<", gets its own buffer)
+		class OutputBuffer;
 
-		// Writes to the stream the newline character, assuming a default log level of TRACE
-		void WriteLine(LogLevel logLevel = LogLevel::TRACE);
+		// Buffered output of a standard stream, shared by all the StreamLoggers writing to it
+		class StreamSink;
 
-		// Writes to the stream a message and inserts values into placeholders (should they exist), assuming a default log level of TRACE
-		template<typename ...T>
-		void Write(const std::string& message, const T& ...t);
+		// Stream tied to std::cin in place of std::cout, so that the messages buffered for the standard output are written before input is read
+		class InputTie;
 
-		// Writes to the stream a message and inserts values into placeholders (should they exist) and finishes with the newline character, assuming a default log level of TRACE
-		template<typename ...T>
-		void WriteLine(const std::string& message, const T& ...t);
+		// Buffered output of a file opened for appending, used by the FileLoggers
+		class FileSink;
 
-		//
-		// Generic Methods: Write a level message (depending on the specified "LOG_LEVEL") to a stream 
-		//
+		// Background thread shared by all the loggers, running their timed tasks (e.g. changing the file of a DailyLogger)
+		class Scheduler;
 
-		// Writes to the stream a message and inserts values into placeholders (should they exist), of "logLevel" importance
-		template<typename ...T>
-		void Write(LogLevel logLevel, const std::string& message, const T& ...t);
+		// Background thread shared by all the loggers, compressing the files closed by rotating loggers
+		class Compressor;
 
-		// Writes to the stream a message and inserts values into placeholders (should they exist) and finishes with the newline character, of "logLevel" importance
-		template<typename ...T>
-		void WriteLine(LogLevel logLevel, const std::string& message, const T& ...t);
+		// Encoder of the messages written by a FileLogger in binary mode, writing the static parts of each message only once per file
+		class BinaryEncoder;
 
-		//
-		// Generic Methods: Write a TRACE level message to a stream
-		//
+		// Used to report (at compile time) a placeholder whose index is greater than the number of arguments
+		void formatPlaceholderWithoutArgument() noexcept;
 
-		// Writes to the stream a message and inserts values into placeholders (should they exist), of TRACE importance
-		template<typename ...T>
-		void Trace(const std::string& message, const T& ...t);
+		// Append a message to "output" in a single pass, replacing "{n}" with the n-th argument and "{{"/"}}" with '{'/'}'
+		void appendMessage(std::string& output, const MessageView& message);
 
-		//
-		// Generic Methods: Write a DEBUG level message to a stream 
-		//
+		// Log format compiled once into a list of tokens, which are rendered in a single pass for every message
+		class FormatProgram
+		{
+			//
+			// Private members
+			//
 
-		// Writes to the stream a message and inserts values into placeholders (should they exist), of DEBUG importance
-		template<typename ...T>
-		void Debug(const std::string& message, const T& ...t);
+			std::vector<FormatToken> m_Tokens;
+			std::string m_Text;
+			unsigned long long m_Id;
+			bool m_HasDates;
+			bool m_HasTime;
+			bool m_HasElapsed;
 
-		//
-		// Generic Methods: Write a INFO level message to a stream 
-		//
+			//
+			// Private methods
+			//
 
-		// Writes to the stream a message and inserts values into placeholders (should they exist), of INFO importance
-		template<typename ...T>
-		void Info(const std::string& message, const T& ...t);
+			// Append literal text, merging it with the previous literal token if possible
+			void addLiteral(const char* text, size_t size);
 
-		//
-		// Generic Methods: Write a WARN level message to a stream 
-		//
+			// Append "count" spaces as literal text
+			void addSpaces(size_t count);
 
-		// Writes to the stream a message and inserts values into placeholders (should they exist), of WARN importance
-		template<typename ...T>
-		void Warn(const std::string& message, const T& ...t);
+			// Append a field token
+			void addField(FormatTokenType type, bool upper = false, size_t offset = 0u, size_t size = 0u);
 
-		//
-		// Generic Methods: Write a ERROR level message to a stream 
-		//
+			// Try to compile the placeholder found at "position" (after '%' and an optional '^'), returns its length or 0 if none matched
+			size_t compilePlaceholder(const std::string& format, size_t position, bool upper);
 
-		// Writes to the stream a message and inserts values into placeholders (should they exist), of ERROR importance
-		template<typename ...T>
-		void Error(const std::string& message, const T& ...t);
+			// Get a new unique program id (never 0)
+			static unsigned long long nextId() noexcept;
 
-		//
-		// Generic Methods: Write a CRITICAL level message to a stream 
-		//
+		public:
+			//
+			// Constructors and destructors
+			//
 
-		// Writes to the stream a message and inserts values into placeholders (should they exist), of CRITICAL importance
-		template<typename ...T>
-		void Critical(const std::string& message, const T& ...t);
-	};
-	// Static member initialization
-	// Check to see what is the current active log level, by default use TRACE
-#if SBLOGGER_LOG_LEVEL == SBLOGGER_LEVEL_DEBUG
-	LOG_LEVELS Logger::s_CurrentLogLevel = LOG_LEVELS::DEBUG;
-#elif SBLOGGER_LOG_LEVEL == SBLOGGER_LEVEL_INFO
-	LOG_LEVELS Logger::s_CurrentLogLevel = LOG_LEVELS::INFO;
-#elif SBLOGGER_LOG_LEVEL == SBLOGGER_LEVEL_WARN
-	LOG_LEVELS Logger::s_CurrentLogLevel = LOG_LEVELS::WARN;
-#elif SBLOGGER_LOG_LEVEL == SBLOGGER_LEVEL_ERROR
-	LOG_LEVELS Logger::s_CurrentLogLevel = LOG_LEVELS::ERROR;
-#elif SBLOGGER_LOG_LEVEL == SBLOGGER_LEVEL_CRITICAL
-	LOG_LEVELS Logger::s_CurrentLogLevel = LOG_LEVELS::CRITICAL;
-#elif SBLOGGER_LOG_LEVEL == SBLOGGER_LEVEL_OFF
-	LOG_LEVELS Logger::s_CurrentLogLevel = LOG_LEVELS::OFF;
-#else
-	LogLevel Logger::s_CurrentLogLevel = LogLevel::TRACE;
-#endif
+			// Creates an empty program, which only outputs the message
+			FormatProgram();
 
-	//
-	// Protected constructors
-	//
+			// Compiles "format", appending the message at the end when the format has no "%msg" (if "appendMessage" is true)
+			FormatProgram(const std::string& format, bool appendMessage = true);
 
-	// Initialize a logger, with a format, auto flush (by default)
-	inline Logger::Logger(const std::string& format, bool autoFlush)
-		: m_Format(format), m_AutoFlush(autoFlush), m_IndentCount(0u)
-	{
-		if (!m_Format.empty())
-		{
-			addPadding(m_Format);
-#ifdef SBLOGGER_LEGACY
-			std::string placeholder = "tr";
-#else
-			std::string_view placeholder = "tr";
-#endif
-			size_t placeholderPosition;
-			while ((placeholderPosition = m_Format.find(placeholder)) != std::string::npos && (m_Format[placeholderPosition - 1u] == '%' || m_Format[placeholderPosition - 2u] == '%'))
-				m_Format[placeholderPosition - 1u] == '^' ? m_Format.replace(placeholderPosition - 2u, placeholder.size() + 2u, "TRACE") : m_Format.replace(placeholderPosition - 1u, placeholder.size() + 2u, "Trace");
+			//
+			// Public methods
+			//
 
-			placeholder = "dbg";
-			while ((placeholderPosition = m_Format.find(placeholder)) != std::string::npos && (m_Format[placeholderPosition - 1u] == '%' || m_Format[placeholderPosition - 2u] == '%'))
-				m_Format[placeholderPosition - 1u] == '^' ? m_Format.replace(placeholderPosition - 2u, placeholder.size() + 2u, "DEBUG") : m_Format.replace(placeholderPosition - 1u, placeholder.size() + 2u, "Debug");
+			// Get the compiled tokens
+			const std::vector<FormatToken>& Tokens() const noexcept;
 
-			placeholder = "inf";
-			while ((placeholderPosition = m_Format.find(placeholder)) != std::string::npos && (m_Format[placeholderPosition - 1u] == '%' || m_Format[placeholderPosition - 2u] == '%'))
-				m_Format[placeholderPosition - 1u] == '^' ? m_Format.replace(placeholderPosition - 2u, placeholder.size() + 2u, "INFO") : m_Format.replace(placeholderPosition - 1u, placeholder.size() + 2u, "Info");
+			// Get the pool of literal and date specifier text the tokens point into
+			const std::string& Text() const noexcept;
 
-			placeholder = "wn";
-			while ((placeholderPosition = m_Format.find(placeholder)) != std::string::npos && (m_Format[placeholderPosition - 1u] == '%' || m_Format[placeholderPosition - 2u] == '%'))
-				m_Format[placeholderPosition - 1u] == '^' ? m_Format.replace(placeholderPosition - 2u, placeholder.size() + 2u, "WARN") : m_Format.replace(placeholderPosition - 1u, placeholder.size() + 2u, "Warn");
+			// Check if any token needs the current date and time
+			bool HasDates() const noexcept;
 
-			placeholder = "er";
-			while ((placeholderPosition = m_Format.find(placeholder)) != std::string::npos && (m_Format[placeholderPosition - 1u] == '%' || m_Format[placeholderPosition - 2u] == '%'))
-				m_Format[placeholderPosition - 1u] == '^' ? m_Format.replace(placeholderPosition - 2u, placeholder.size() + 2u, "ERROR") : m_Format.replace(placeholderPosition - 1u, placeholder.size() + 2u, "Error");
+			// Check if any token needs the time of the message (dates or fractions of a second)
+			bool HasTime() const noexcept;
 
-			placeholder = "crt";
-			while ((placeholderPosition = m_Format.find(placeholder)) != std::string::npos && (m_Format[placeholderPosition - 1u] == '%' || m_Format[placeholderPosition - 2u] == '%'))
-				m_Format[placeholderPosition - 1u] == '^' ? m_Format.replace(placeholderPosition - 2u, placeholder.size() + 2u, "CRITICAL") : m_Format.replace(placeholderPosition - 1u, placeholder.size() + 2u, "Critical");
-		}
-	}
+			// Check if any token needs the time elapsed since the first logger was created
+			bool HasElapsed() const noexcept;
 
-	// Initialize a logger, with no format, auto flush (by default)
-	inline Logger::Logger(bool autoFlush) noexcept
-		: m_Format(), m_AutoFlush(autoFlush), m_IndentCount(0u)
-	{ }
+			// Get the id of the program, unique for each compiled format
+			unsigned long long Id() const noexcept;
+		};
 
-	// Copy constructor
-	inline Logger::Logger(const Logger& other) noexcept
-		: m_Format(other.m_Format), m_AutoFlush(other.m_AutoFlush), m_IndentCount(other.m_IndentCount)
-	{ }
+		// Converts "time" to local time, without sharing the result between threads (as std::localtime does)
+		bool localTime(std::time_t time, std::tm& result) noexcept;
+#ifndef SBLOGGER_OLD_DATES
 
-	//
-	// Protected methods
-	//
+		// Get the time zone of the system (looked up only once)
+		const std::chrono::time_zone* currentZone();
+#endif
 
-	// Converts a T value to a string to be used in writing a log
-	template<typename T>
-	inline std::string Logger::stringConvert(const T& t) const noexcept
-	{
-		std::stringstream ss;
-		ss << t;
-		return ss.str();
-	}
+		// Date and time placeholders of formats, rendered at most once per second by each thread
+		class DateCache
+		{
+		public:
+			// Date placeholders of a format, rendered for a given second
+			struct Entry
+			{
+				unsigned long long programId;
+				std::time_t second;
+				std::string text;
+				std::vector<size_t> ends;
+			};
 
-	// Adds ANSII colour codes if current stream supports them
-	// (The Logger base class does not do anything with the message, the method needing implementation from derived classes)
-	inline void Logger::addColours(std::string& message) const noexcept
-	{ 
-		char colours[][12]{ { "reset" }, { "black" }, { "red" }, { "green" }, { "yellow" }, { "blue" }, { "magenta" }, { "cyan" }, { "white" },
-				{ "bg-black" }, { "bg-red" }, { "bg-green" }, { "bg-yellow" }, { "bg-blue" }, { "bg-magenta" }, { "bg-cyan" }, { "bg-white" } };
+			//
+			// Public methods
+			//
 
-		size_t placeholderPosition, placeholderSize;
-		char currentColour[17]{ '{' };
+			// Get the date placeholders of "program" rendered for "second" (only rendering them when the second or the program changes)
+			static const Entry& Get(const FormatProgram& program, std::time_t second);
 
-		for (size_t i = 0u; i < 17u; ++i)
-			if ((placeholderPosition = message.find(colours[i])) != std::string::npos
-				&& placeholderPosition > 1u && message[placeholderPosition - 1u] == '{'
-				&& placeholderPosition < (message.size() - 1u) && message[placeholderPosition + std::strlen(colours[i])] == '}')
-			{
-				std::strncpy(currentColour + 1, colours[i], std::strlen(colours[i]) + 1u);
-				std::strncat(currentColour, "}", 1u);
-				while ((placeholderPosition = message.find(currentColour)) != std::string::npos)
-				{
-					placeholderSize = std::strlen(currentColour);
-					message[placeholderPosition - 1u] == '^' ?
-						message.replace(placeholderPosition - 2u, placeholderSize + 2u, "")
-						: message.replace(placeholderPosition - 1u, placeholderSize + 1u, "");
-				}
-			}
-	}
+		private:
+			//
+			// Private members
+			//
 
-	// Add indent to string (if it is set)
-	inline void Logger::addIndent(std::string& message) const noexcept
-	{
-		for (size_t i = 0u; i < m_IndentCount; ++i)
-			message = '\t' + message;
-	}
+			// Number of formats each thread keeps rendered dates for
+			static const size_t NO_ENTRIES = 4u;
+		};
 
-	// Add padding to string (if padding format exists)
-	inline void Logger::addPadding(std::string& message) const noexcept
-	{
-#ifdef SBLOGGER_LEGACY
-		std::string placeholders[] { "msg", "lvl", "tr", "dbg", "inf", "wn", "er", "crt" };
-#else
-		std::string_view placeholders[] { "msg", "lvl", "tr", "dbg", "inf", "wn", "er", "crt" };
-#endif
-		std::string digits = "1234567890", floatDigits = "1234567890.", currentPadding;
-		size_t placeholderPosition, offset = 0u, noDigits, noDecimals, currentSectionEnd, placeholderSize, noPlaceholders = 8u;
-		float noSpacesLeft, noSpacesRight;
-		char nextCharacter;
+		// Append "value" to "output" as decimal digits, padded with zeros to at least "width" digits
+		void appendDigits(std::string& output, unsigned long long value, size_t width = 0u);
 
-		while ((placeholderPosition = message.find_first_of(digits, offset)) != std::string::npos)
+		// Source of the timestamps of messages: std::chrono::system_clock, CLOCK_REALTIME_COARSE or the TSC converted to wall time
+		class Clock
 		{
-			if (message[placeholderPosition - 1u] != '%' && (placeholderPosition > 1u && message[placeholderPosition - 2u] != '%' && message[placeholderPosition - 1u] != '.'))
-				offset += placeholderPosition + 1u;
-			else
+			//
+			// Private members
+			//
+
+			// Conversion of TSC ticks to wall time, published with a sequence lock (odd while being updated)
+			struct TscCalibration
 			{
-				if(message[placeholderPosition - 1u] != '%')
-					currentPadding = message.substr(placeholderPosition - 1u, message.find_first_not_of(floatDigits, placeholderPosition + 1u) - placeholderPosition + 1u);
-				else
-					currentPadding = message.substr(placeholderPosition, message.find_first_not_of(floatDigits, placeholderPosition) - placeholderPosition);
-				
-				noDigits = currentPadding.size();
-				noDecimals = (noDecimals = currentPadding.find('.')) != std::string::npos ? (noDigits - noDecimals - 1u) : 0u;
-				noSpacesRight = std::modf(std::stof(currentPadding), &noSpacesLeft);
-				for (size_t i = 0u; i < noDecimals; ++i)
-					noSpacesRight *= 10;
-
-				placeholderSize = 0u;
-				for (size_t i = 0u; i < noPlaceholders && !placeholderSize; ++i)
-					if ((currentSectionEnd = message.find(placeholders[i], placeholderPosition + noDigits)) != std::string::npos && placeholderPosition + noDigits == currentSectionEnd - 1u)
-						placeholderSize = placeholders[i].size();
-
-				if (noSpacesRight && (placeholderSize || (currentSectionEnd = message.find_first_of(" .-,@#(){}[]'\"\\/!`~|;:?><=+-_%&*", placeholderPosition + noDigits + 1u)) != std::string::npos))
-				{
-					nextCharacter = message[placeholderSize ? (currentSectionEnd + placeholderSize) : currentSectionEnd];
-					message.replace(placeholderSize ? (currentSectionEnd + placeholderSize) : currentSectionEnd, 1u, (size_t)noSpacesRight + 1u, ' ');
-					if(nextCharacter != ' ')
-						message[placeholderSize ? (currentSectionEnd + placeholderSize) : (currentSectionEnd + (size_t)noSpacesRight)] = nextCharacter;
-				}
+				std::mutex mutex;
+				std::atomic<unsigned> sequence;
+				std::atomic<unsigned long long> baseTicks;
+				std::atomic<long long> baseTime;
+				std::atomic<double> nanosecondsPerTick;
+				unsigned long long firstTicks;
+				long long firstTime;
+			};
 
-				message.replace(placeholderPosition - 1u, noDigits + 1u, !placeholderSize ? (size_t)noSpacesLeft : ((size_t)noSpacesLeft + 1u) , ' ');
-				if (placeholderSize)
-					message[placeholderPosition + (size_t)noSpacesLeft] = '%';
-			}
-		}
-	}
+			// Number of nanoseconds after which the TSC is synchronised again with the system clock
+			static const long long TSC_SYNC_INTERVAL = 1000000000ll;
 
-	// Append format (if it exists) and replace all "{n}" placeholders with their respective values (n=0,...)
-	inline std::string Logger::replacePlaceholders(std::string message, const std::vector<std::string>& items) const noexcept
-	{
-		bool hasMacros = false;
-		std::string placeholder;
-		size_t placeholderPosition, placeholderSize, noArguments = items.size();
+			//
+			// Private methods
+			//
 
-		if(noArguments > 3u)
-			for (size_t i = noArguments - 1u; i >= 0u && !hasMacros; --i)
-				if (items[i] == "__MACROS__")
-					hasMacros = true;
+			// Get the shared TSC calibration
+			static TscCalibration& tscCalibration() noexcept;
 
-		for (size_t i = 0u; i < noArguments; ++i)
-		{
-			placeholderSize = (placeholder = '{' + std::to_string(i) + '}').size();
-			while ((placeholderPosition = message.find(placeholder)) != std::string::npos)
-				message.replace(placeholderPosition, placeholderSize, items[i]);
-		}
-		
-		if(!m_Format.empty())
-			message = (placeholderPosition = m_Format.find("%msg")) != std::string::npos ? std::string(m_Format).replace(placeholderPosition, 4u, message) : (m_Format + ' ' + message);
+			// Get the current wall time from the TSC, falling back to the system clock until it is calibrated
+			static std::chrono::system_clock::time_point tscNow() noexcept;
+
+			// Measure the TSC against the system clock and publish the new conversion (refining the rate since the first measurement)
+			static void synchroniseTsc(bool wait) noexcept;
+
+		public:
+			//
+			// Public methods
+			//
+
+			// Get the current wall time using "clock"
+			static std::chrono::system_clock::time_point Now(ClockType clock) noexcept;
+
+			// Prepare "clock" for use (e.g. calibrate the TSC), should be called away from the logging calls
+			static void Prepare(ClockType clock) noexcept;
+
+			// Get the (monotonic) time elapsed since the first logger was created
+			static std::chrono::nanoseconds Elapsed() noexcept;
+		};
+
+		//
+		// Public methods
+		//
+
+		// Get the name of a log level (e.g. "Error" or "ERROR")
+		inline const char* levelName(LogLevel level, bool upper) noexcept
+		{
+			static const char* names[][2]{ { "Trace", "TRACE" }, { "Debug", "DEBUG" }, { "Info", "INFO" },
+				{ "Warn", "WARN" }, { "Error", "ERROR" }, { "Critical", "CRITICAL" }, { "", "" } };
+
+			return names[static_cast<size_t>(level)][upper ? 1 : 0];
+		}
+
+		// Get the name of the source file found at "path" (after its last path separator, or "name" if there is none), at compile time for the logging macros
+		constexpr const char* sourceFileName(const char* path, const char* name) noexcept
+		{
+			return *path == '\0' ? name : sourceFileName(path + 1, *path == SBLOGGER_PATH_SEPARATOR ? path + 1 : name);
+		}
+
+		// Check if "text" matches "pattern", in which '*' matches any characters and '?' a single one
+		inline bool matchesPattern(const char* pattern, const char* text) noexcept
+		{
+			const char* star = nullptr;
+			const char* starText = nullptr;
+
+			while (*text != '\0')
+			{
+				if (*pattern == '*')
+				{
+					star = pattern++;
+					starText = text;
+				}
+				else if (*pattern == '?' || *pattern == *text)
+				{
+					++pattern;
+					++text;
+				}
+				else if (star != nullptr)
+				{
+					// Let the last '*' match one more character and try again
+					pattern = star + 1;
+					text = ++starText;
+				}
+				else
+					return false;
+			}
+
+			while (*pattern == '*')
+				++pattern;
+			return *pattern == '\0';
+		}
+
+		// Used to report (at compile time) a placeholder whose index is greater than the number of arguments
+		inline void formatPlaceholderWithoutArgument() noexcept
+		{ }
+
+		// Append a message to "output" in a single pass, replacing "{n}" with the n-th argument and "{{"/"}}" with '{'/'}'
+		inline void appendMessage(std::string& output, const MessageView& message)
+		{
+			const char* current = message.data, *literalStart = message.data, *end = message.data + message.size, *position;
+			size_t argument;
+
+			// Precomputed segments only need to append the literals and the arguments
+			if (message.segments != nullptr)
+			{
+				for (size_t i = 0u; i < message.noSegments; ++i)
+				{
+					output.append(message.data + message.segments[i].offset, message.segments[i].size);
+					if (message.segments[i].argument < message.noArguments)
+						message.arguments[message.segments[i].argument].format(output, message.arguments[message.segments[i].argument].value);
+					else if (message.segments[i].argument != FormatSegment::NO_ARGUMENT)
+						// Placeholders which do not have a respective argument are written as is
+						output.append(message.data + message.segments[i].offset + message.segments[i].size,
+							(i + 1u < message.noSegments ? message.segments[i + 1u].offset : message.size) - message.segments[i].offset - message.segments[i].size);
+				}
+				return;
+			}
+
+			for (; current < end; ++current)
+				if (*current == '{')
+				{
+					if (current + 1 < end && current[1] == '{')
+					{
+						output.append(literalStart, ++current);
+						literalStart = current + 1;
+						continue;
+					}
+
+					// Placeholders which do not have a respective argument are written as is
+					for (position = current + 1, argument = 0u; position < end && position - current <= 9 && *position >= '0' && *position <= '9'; ++position)
+						argument = argument * 10u + static_cast<size_t>(*position - '0');
+					if (position > current + 1 && position < end && *position == '}' && argument < message.noArguments)
+					{
+						output.append(literalStart, current);
+						message.arguments[argument].format(output, message.arguments[argument].value);
+						literalStart = (current = position) + 1;
+					}
+				}
+				else if (*current == '}' && current + 1 < end && current[1] == '}')
+				{
+					output.append(literalStart, ++current);
+					literalStart = current + 1;
+				}
+
+			output.append(literalStart, end);
+		}
+
+		//
+		// Constructors and destructors
+		//
+
+		// Creates an empty program, which only outputs the message
+		inline FormatProgram::FormatProgram()
+			: m_Tokens{ { FormatTokenType::MESSAGE, false, 0u, 0u } }, m_Text(), m_Id(nextId()), m_HasDates(false), m_HasTime(false), m_HasElapsed(false)
+		{ }
+
+		// Compiles "format", appending the message at the end when the format has no "%msg" (if "appendMessage" is true)
+		inline FormatProgram::FormatProgram(const std::string& format, bool appendMessage)
+			: m_Tokens(), m_Text(), m_Id(nextId()), m_HasDates(false), m_HasTime(false), m_HasElapsed(false)
+		{
+			size_t position = 0u, formatSize = format.size(), placeholderSize, placeholderStart, noSpacesLeft, noSpacesRight = 0u;
+			bool upper;
+
+			m_Text.reserve(formatSize);
+			while (position < formatSize)
+			{
+				if (format[position] != '%')
+				{
+					placeholderStart = position;
+					while (position < formatSize && format[position] != '%')
+						++position;
+					addLiteral(format.data() + placeholderStart, position - placeholderStart);
+					addSpaces(noSpacesRight);
+					noSpacesRight = 0u;
+					continue;
+				}
+
+				// Padding: "%N.M" adds N spaces before and M spaces after the next placeholder (e.g. "%5.2lvl")
+				placeholderStart = ++position;
+				noSpacesLeft = noSpacesRight = 0u;
+				while (position < formatSize && std::isdigit(static_cast<unsigned char>(format[position])))
+					noSpacesLeft = noSpacesLeft * 10u + static_cast<size_t>(format[position++] - '0');
+				if (position > placeholderStart && position + 1u < formatSize && format[position] == '.' && std::isdigit(static_cast<unsigned char>(format[position + 1u])))
+					while (++position < formatSize && std::isdigit(static_cast<unsigned char>(format[position])))
+						noSpacesRight = noSpacesRight * 10u + static_cast<size_t>(format[position] - '0');
+				addSpaces(noSpacesLeft);
+
+				upper = position < formatSize && format[position] == '^';
+				if ((placeholderSize = compilePlaceholder(format, upper ? position + 1u : position, upper)) != 0u)
+				{
+					position += placeholderSize + (upper ? 1u : 0u);
+					addSpaces(noSpacesRight);
+					noSpacesRight = 0u;
+				}
+				else if (position == placeholderStart)
+					// Not a placeholder, keep the '%' as is
+					addLiteral("%", 1u);
+			}
+			addSpaces(noSpacesRight);
+
+			bool hasMessage = false;
+			for (const FormatToken& token : m_Tokens)
+				if (token.type == FormatTokenType::MESSAGE)
+					hasMessage = true;
+
+			if (appendMessage && !hasMessage)
+			{
+				if (!m_Tokens.empty())
+					addLiteral(" ", 1u);
+				addField(FormatTokenType::MESSAGE);
+			}
+		}
+
+		//
+		// Private methods
+		//
+
+		// Append literal text, merging it with the previous literal token if possible
+		inline void FormatProgram::addLiteral(const char* text, size_t size)
+		{
+			if (!size)
+				return;
+
+			if (!m_Tokens.empty() && m_Tokens.back().type == FormatTokenType::LITERAL && m_Tokens.back().offset + m_Tokens.back().size == m_Text.size())
+				m_Tokens.back().size += size;
+			else
+				m_Tokens.push_back({ FormatTokenType::LITERAL, false, m_Text.size(), size });
+			m_Text.append(text, size);
+		}
+
+		// Append "count" spaces as literal text
+		inline void FormatProgram::addSpaces(size_t count)
+		{
+			if (!count)
+				return;
+
+			addLiteral(" ", 1u);
+			m_Text.append(count - 1u, ' ');
+			m_Tokens.back().size += count - 1u;
+		}
+
+		// Append a field token
+		inline void FormatProgram::addField(FormatTokenType type, bool upper, size_t offset, size_t size)
+		{
+			m_Tokens.push_back({ type, upper, offset, size });
+		}
+
+		// Try to compile the placeholder found at "position" (after '%' and an optional '^'), returns its length or 0 if none matched
+		inline size_t FormatProgram::compilePlaceholder(const std::string& format, size_t position, bool upper)
+		{
+			static const struct Colour
+			{
+				char name[12];
+				size_t code;
+			} colours[]{ { "reset", 0 }, { "black", 30 }, { "red", 31 }, { "green", 32 }, { "yellow", 33 }, { "blue", 34 }, { "magenta", 35 }, { "cyan", 36 }, { "white", 37 },
+				{ "bg-black", 40 }, { "bg-red", 41 }, { "bg-green", 42 }, { "bg-yellow", 43 }, { "bg-blue", 44 }, { "bg-magenta", 45 }, { "bg-cyan", 46 }, { "bg-white", 47 } };
+			static const struct Field
+			{
+				char name[5];
+				FormatTokenType type;
+				LogLevel level;
+			} fields[]{ { "msg", FormatTokenType::MESSAGE, LogLevel::OFF }, { "lvl", FormatTokenType::LEVEL, LogLevel::OFF },
+				{ "fsrc", FormatTokenType::FULL_SOURCE, LogLevel::OFF }, { "src", FormatTokenType::SOURCE, LogLevel::OFF }, { "ln", FormatTokenType::LINE, LogLevel::OFF },
+				{ "func", FormatTokenType::FUNCTION, LogLevel::OFF }, { "fnc", FormatTokenType::FUNCTION, LogLevel::OFF },
+				{ "tr", FormatTokenType::LITERAL, LogLevel::TRACE }, { "dbg", FormatTokenType::LITERAL, LogLevel::DEBUG }, { "inf", FormatTokenType::LITERAL, LogLevel::INFO },
+				{ "wn", FormatTokenType::LITERAL, LogLevel::WARN }, { "er", FormatTokenType::LITERAL, LogLevel::ERROR }, { "crt", FormatTokenType::LITERAL, LogLevel::CRITICAL },
+				{ "ms", FormatTokenType::MILLISECONDS, LogLevel::OFF }, { "us", FormatTokenType::MICROSECONDS, LogLevel::OFF }, { "ns", FormatTokenType::NANOSECONDS, LogLevel::OFF },
+				{ "el", FormatTokenType::ELAPSED, LogLevel::OFF } };
+			static const char dateSpecifiers[] = "aAbBcCdDeFgGhHIjmMnprRStTuUVwWxXyYzZ";
+
+			size_t nameSize;
+			if (position >= format.size())
+				return 0u;
+
+			// Colours (e.g. "%{red}" or "%^{red}" for the bright variant)
+			if (format[position] == '{')
+				for (const Colour& colour : colours)
+					if (format.compare(position + 1u, nameSize = std::strlen(colour.name), colour.name) == 0 && position + nameSize + 1u < format.size() && format[position + nameSize + 1u] == '}')
+					{
+						addField(FormatTokenType::COLOUR, upper, colour.code);
+						return nameSize + 2u;
+					}
+
+			for (const Field& field : fields)
+				if (format.compare(position, nameSize = std::strlen(field.name), field.name) == 0)
+				{
+					if (field.type == FormatTokenType::LITERAL)
+					{
+						const char* name = levelName(field.level, upper);
+						addLiteral(name, std::strlen(name));
+					}
+					else
+						addField(field.type, upper);
+					if (field.type == FormatTokenType::MILLISECONDS || field.type == FormatTokenType::MICROSECONDS || field.type == FormatTokenType::NANOSECONDS)
+						m_HasTime = true;
+					else if (field.type == FormatTokenType::ELAPSED)
+						m_HasElapsed = true;
+					return nameSize;
+				}
+
+			// Everything else is left to std::strftime (e.g. "%F", "%Ey" or "%%")
+			if (upper)
+				return 0u;
+			nameSize = (format[position] == 'E' || format[position] == 'O') && position + 1u < format.size() ? 2u : 1u;
+			if (format[position] != '%' && !std::strchr(dateSpecifiers, format[position + nameSize - 1u]))
+				return 0u;
+			if (format[position] == '%')
+			{
+				addLiteral("%", 1u);
+				return 1u;
+			}
+
+#ifdef SBLOGGER_OLD_DATES
+			// Stored as a (null terminated) std::strftime format, e.g. "%F"
+			addField(FormatTokenType::DATE, false, m_Text.size(), nameSize + 1u);
+			m_Text.append(1u, '%').append(format, position, nameSize).append(1u, '\0');
+#else
+			// Stored as a std::format chrono specification, e.g. "{:%F}"
+			addField(FormatTokenType::DATE, false, m_Text.size(), nameSize + 4u);
+			m_Text.append("{:%", 3u).append(format, position, nameSize).append(1u, '}');
+#endif
+			m_HasDates = m_HasTime = true;
+			return nameSize;
+		}
+
+		//
+		// Public methods
+		//
+
+		// Get the compiled tokens
+		inline const std::vector<FormatToken>& FormatProgram::Tokens() const noexcept
+		{
+			return m_Tokens;
+		}
+
+		// Get the pool of literal and date specifier text the tokens point into
+		inline const std::string& FormatProgram::Text() const noexcept
+		{
+			return m_Text;
+		}
+
+		// Check if any token needs the current date and time
+		inline bool FormatProgram::HasDates() const noexcept
+		{
+			return m_HasDates;
+		}
+
+		// Check if any token needs the time of the message (dates or fractions of a second)
+		inline bool FormatProgram::HasTime() const noexcept
+		{
+			return m_HasTime;
+		}
+
+		// Check if any token needs the time elapsed since the first logger was created
+		inline bool FormatProgram::HasElapsed() const noexcept
+		{
+			return m_HasElapsed;
+		}
+
+		// Get the id of the program, unique for each compiled format
+		inline unsigned long long FormatProgram::Id() const noexcept
+		{
+			return m_Id;
+		}
+
+		// Get a new unique program id (never 0)
+		inline unsigned long long FormatProgram::nextId() noexcept
+		{
+			static std::atomic<unsigned long long> lastId(0u);
+			return ++lastId;
+		}
+
+		// Converts "time" to local time, without sharing the result between threads (as std::localtime does)
+		inline bool localTime(std::time_t time, std::tm& result) noexcept
+		{
+#ifdef _WIN32
+			return localtime_s(&result, &time) == 0;
+#else
+			return localtime_r(&time, &result) != nullptr;
+#endif
+		}
+#ifndef SBLOGGER_OLD_DATES
+
+		// Get the time zone of the system (looked up only once)
+		inline const std::chrono::time_zone* currentZone()
+		{
+			static const std::chrono::time_zone* zone = std::chrono::current_zone();
+			return zone;
+		}
+#endif
+
+		// Get the date placeholders of "program" rendered for "second" (only rendering them when the second or the program changes)
+		inline const DateCache::Entry& DateCache::Get(const FormatProgram& program, std::time_t second)
+		{
+			static thread_local Entry entries[NO_ENTRIES]{};
+			static thread_local size_t nextEntry = 0u;
+			Entry* entry = nullptr;
+#ifdef SBLOGGER_OLD_DATES
+			std::tm currentTime{};
+			char buffer[128];
+			size_t size;
+#endif
+
+			for (Entry& current : entries)
+				if (current.programId == program.Id())
+				{
+					if (current.second == second)
+						return current;
+					entry = &current;
+				}
+
+			if (entry == nullptr)
+			{
+				entry = &entries[nextEntry];
+				nextEntry = (nextEntry + 1u) % NO_ENTRIES;
+			}
+
+			entry->programId = program.Id();
+			entry->second = second;
+			entry->text.clear();
+			entry->ends.clear();
+#ifdef SBLOGGER_OLD_DATES
+			localTime(second, currentTime);
+			for (const FormatToken& token : program.Tokens())
+				if (token.type == FormatTokenType::DATE)
+				{
+					if ((size = std::strftime(buffer, sizeof(buffer), program.Text().c_str() + token.offset, &currentTime)) != 0u)
+						entry->text.append(buffer, size);
+					entry->ends.push_back(entry->text.size());
+				}
+#else
+			const std::chrono::zoned_time<std::chrono::seconds> currentTime(currentZone(), std::chrono::sys_seconds(std::chrono::seconds(second)));
+			for (const FormatToken& token : program.Tokens())
+				if (token.type == FormatTokenType::DATE)
+				{
+					// Specifications which are not valid for std::format (e.g. "%Ea") are left empty, as std::strftime does
+					try
+					{
+						std::vformat_to(std::back_inserter(entry->text), std::string_view(program.Text().data() + token.offset, token.size), std::make_format_args(currentTime));
+					}
+					catch (const std::format_error&)
+					{ }
+					entry->ends.push_back(entry->text.size());
+				}
+#endif
+
+			return *entry;
+		}
+
+		// Append "value" to "output" as decimal digits, padded with zeros to at least "width" digits
+		inline void appendDigits(std::string& output, unsigned long long value, size_t width)
+		{
+			char digits[24];
+			size_t size = 0u;
+
+			do
+				digits[size++] = static_cast<char>('0' + value % 10u);
+			while ((value /= 10u) != 0u);
+			if (width > size)
+				output.append(width - size, '0');
+			while (size > 0u)
+				output.push_back(digits[--size]);
+		}
+
+		//
+		// Private methods
+		//
+
+		// Get the shared TSC calibration
+		inline Clock::TscCalibration& Clock::tscCalibration() noexcept
+		{
+			static TscCalibration calibration{};
+			return calibration;
+		}
+
+		// Get the current wall time from the TSC, falling back to the system clock until it is calibrated
+		inline std::chrono::system_clock::time_point Clock::tscNow() noexcept
+		{
+#ifdef SBLOGGER_TSC
+			TscCalibration& calibration = tscCalibration();
+			unsigned long long ticks = __rdtsc(), baseTicks;
+			unsigned sequence;
+			long long baseTime, nanoseconds;
+			double nanosecondsPerTick;
+
+			do
+			{
+				sequence = calibration.sequence.load(std::memory_order_acquire);
+				baseTicks = calibration.baseTicks.load(std::memory_order_relaxed);
+				baseTime = calibration.baseTime.load(std::memory_order_relaxed);
+				nanosecondsPerTick = calibration.nanosecondsPerTick.load(std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_acquire);
+			} while ((sequence & 1u) != 0u || sequence != calibration.sequence.load(std::memory_order_relaxed));
+
+			if (nanosecondsPerTick > 0.0 && ticks >= baseTicks)
+			{
+				nanoseconds = static_cast<long long>(static_cast<double>(ticks - baseTicks) * nanosecondsPerTick);
+				if (nanoseconds > TSC_SYNC_INTERVAL)
+					synchroniseTsc(false);
+				return std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(baseTime + nanoseconds)));
+			}
+#endif
+			return std::chrono::system_clock::now();
+		}
+
+		// Measure the TSC against the system clock and publish the new conversion (refining the rate since the first measurement)
+		inline void Clock::synchroniseTsc(bool wait) noexcept
+		{
+#ifdef SBLOGGER_TSC
+			TscCalibration& calibration = tscCalibration();
+			std::unique_lock<std::mutex> lock(calibration.mutex, std::defer_lock);
+			unsigned long long ticks;
+			long long time;
+			unsigned sequence;
+
+			if (wait)
+				lock.lock();
+			else if (!lock.try_lock())
+				return;
+
+			ticks = __rdtsc();
+			time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+			if (calibration.firstTicks == 0u)
+			{
+				calibration.firstTicks = ticks;
+				calibration.firstTime = time;
+				if (!wait)
+					return;
+
+				// First calibration, measure the rate over a short interval
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+				ticks = __rdtsc();
+				time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+			}
+			if (ticks <= calibration.firstTicks || time <= calibration.firstTime)
+				return;
+
+			sequence = calibration.sequence.load(std::memory_order_relaxed);
+			calibration.sequence.store(sequence + 1u, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			calibration.baseTicks.store(ticks, std::memory_order_relaxed);
+			calibration.baseTime.store(time, std::memory_order_relaxed);
+			calibration.nanosecondsPerTick.store(static_cast<double>(time - calibration.firstTime) / static_cast<double>(ticks - calibration.firstTicks), std::memory_order_relaxed);
+			calibration.sequence.store(sequence + 2u, std::memory_order_release);
+#else
+			(void)wait;
+#endif
+		}
+
+		//
+		// Public methods
+		//
+
+		// Get the current wall time using "clock"
+		inline std::chrono::system_clock::time_point Clock::Now(ClockType clock) noexcept
+		{
+			switch (clock)
+			{
+			case ClockType::TSC:
+				return tscNow();
+			case ClockType::REALTIME_COARSE:
+#if defined SBLOGGER_NIX && defined CLOCK_REALTIME_COARSE
+				{
+					timespec time;
+					if (clock_gettime(CLOCK_REALTIME_COARSE, &time) == 0)
+						return std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(
+							std::chrono::seconds(time.tv_sec) + std::chrono::nanoseconds(time.tv_nsec)));
+				}
+#endif
+				return std::chrono::system_clock::now();
+			default:
+				return std::chrono::system_clock::now();
+			}
+		}
+
+		// Prepare "clock" for use (e.g. calibrate the TSC), should be called away from the logging calls
+		inline void Clock::Prepare(ClockType clock) noexcept
+		{
+			Elapsed();
+			if (clock == ClockType::TSC && tscCalibration().nanosecondsPerTick.load(std::memory_order_acquire) <= 0.0)
+				synchroniseTsc(true);
+		}
+
+		// Get the (monotonic) time elapsed since the first logger was created
+		inline std::chrono::nanoseconds Clock::Elapsed() noexcept
+		{
+			static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+		}
+	}
+
+	//
+	// Formatters
+	//
+
+	// Appends the text representation of a T value to the output of a log, using its "operator<<"
+	// (Specialize it as "template<> struct Formatter<MyType> { static void Format(std::string& output, const MyType& value); };" for your own types)
+	template<typename T, typename>
+	struct Formatter
+	{
+		// Append "value" to "output"
+		static void Format(std::string& output, const T& value)
+		{
+			// A single stream is reused by each thread, unless it is already in use (e.g. by a nested log)
+			static thread_local std::ostringstream stream;
+			static thread_local bool inUse = false;
+
+			if (inUse)
+			{
+				std::ostringstream nestedStream;
+				nestedStream << value;
+				output.append(nestedStream.str());
+				return;
+			}
+
+			inUse = true;
+			stream.str(std::string());
+			stream.clear();
+			stream.flags(std::ios_base::dec | std::ios_base::skipws);
+			stream.precision(6);
+			stream.width(0);
+			stream.fill(' ');
+			stream << value;
+			output.append(stream.str());
+			inUse = false;
+		}
+	};
+
+	// Appends integral values (except bool and characters, which have their own formatters)
+	template<typename T>
+	struct Formatter<T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value && !std::is_same<T, char>::value
+		&& !std::is_same<T, signed char>::value && !std::is_same<T, unsigned char>::value>::type>
+	{
+		// Append "value" to "output"
+		static void Format(std::string& output, const T& value)
+		{
+			char buffer[24];
+#ifdef SBLOGGER_LEGACY
+			using Unsigned = typename std::make_unsigned<T>::type;
+			char* end = buffer + sizeof(buffer), *begin = end;
+			Unsigned absolute = value < 0 ? static_cast<Unsigned>(0u - static_cast<Unsigned>(value)) : static_cast<Unsigned>(value);
+
+			do
+				*--begin = static_cast<char>('0' + absolute % 10u);
+			while ((absolute /= 10u) != 0u);
+			if (value < 0)
+				*--begin = '-';
+			output.append(begin, end);
+#else
+			output.append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), value).ptr);
+#endif
+		}
+	};
+
+	// Appends floating point values, the same way a std::ostream does by default (i.e. "%g" with a precision of 6)
+	template<typename T>
+	struct Formatter<T, typename std::enable_if<std::is_floating_point<T>::value>::type>
+	{
+		// Append "value" to "output"
+		static void Format(std::string& output, const T& value)
+		{
+			char buffer[64];
+#if defined __cpp_lib_to_chars && !defined SBLOGGER_LEGACY
+			output.append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::general, 6).ptr);
+#else
+			int size = std::snprintf(buffer, sizeof(buffer), "%.6Lg", static_cast<long double>(value));
+			if (size > 0)
+				output.append(buffer, static_cast<size_t>(size) < sizeof(buffer) ? static_cast<size_t>(size) : sizeof(buffer) - 1u);
+#endif
+		}
+	};
+
+	// Appends booleans as "1" or "0" (the same way a std::ostream does by default)
+	template<>
+	struct Formatter<bool>
+	{
+		// Append "value" to "output"
+		static void Format(std::string& output, bool value)
+		{
+			output.push_back(value ? '1' : '0');
+		}
+	};
+
+	// Appends characters
+	template<typename T>
+	struct Formatter<T, typename std::enable_if<std::is_same<T, char>::value || std::is_same<T, signed char>::value || std::is_same<T, unsigned char>::value>::type>
+	{
+		// Append "value" to "output"
+		static void Format(std::string& output, T value)
+		{
+			output.push_back(static_cast<char>(value));
+		}
+	};
+
+	// Appends C strings
+	template<>
+	struct Formatter<const char*>
+	{
+		// Append "value" to "output"
+		static void Format(std::string& output, const char* value)
+		{
+			if (value != nullptr)
+				output.append(value);
+		}
+	};
+
+	// Appends C strings
+	template<>
+	struct Formatter<char*> : Formatter<const char*>
+	{ };
+
+	// Appends character arrays (e.g. string literals), up to their null terminator
+	template<size_t N>
+	struct Formatter<char[N]>
+	{
+		// Append "value" to "output"
+		static void Format(std::string& output, const char (&value)[N])
+		{
+			size_t size = 0u;
+			while (size < N && value[size] != '\0')
+				++size;
+			output.append(value, size);
+		}
+	};
+
+	// Appends strings
+	template<>
+	struct Formatter<std::string>
+	{
+		// Append "value" to "output"
+		static void Format(std::string& output, const std::string& value)
+		{
+			output.append(value);
+		}
+	};
+
+#ifndef SBLOGGER_LEGACY
+	// Appends string views
+	template<>
+	struct Formatter<std::string_view>
+	{
+		// Append "value" to "output"
+		static void Format(std::string& output, std::string_view value)
+		{
+			output.append(value.data(), value.size());
+		}
+	};
+#endif
+
+	// Appends the result of callables taking no arguments (e.g. lambdas), which are only called if the message is written
+	template<typename T>
+	struct Formatter<T, typename std::enable_if<detail::IsLazyArgument<T>::value>::type>
+	{
+		// Append the result of calling "value" to "output"
+		static void Format(std::string& output, const T& value)
+		{
+			const auto& result = value();
+			Formatter<typename std::decay<decltype(value())>::type>::Format(output, result);
+		}
+	};
+
+	namespace detail
+	{
+		// Converts the argument found at "value" (of type T) to text, appending it to "output"
+		template<typename T>
+		void formatArgument(std::string& output, const void* value)
+		{
+			Formatter<T>::Format(output, *static_cast<const T*>(value));
+		}
+
+		// Creates a type-erased reference to an argument
+		template<typename T>
+		FormatArgument makeArgument(const T& value) noexcept
+		{
+			return { &value, &formatArgument<T> };
+		}
+
+		// Reusable output buffer of the current thread (each nested log, e.g. made from an "operator<<", gets its own buffer)
+		class OutputBuffer
+		{
+			//
+			// Private members
+			//
+
+			// Buffers larger than this are released after being used, instead of being kept for the next message
+			static const size_t MAX_KEPT_CAPACITY = 64u * 1024u;
+
+			std::string& m_Buffer;
+
+			//
+			// Private methods
+			//
+
+			// Get the buffers of the current thread and the number of those which are in use
+			static std::deque<std::string>& buffers(size_t*& noBuffersInUse) noexcept;
+
+			// Get a free buffer of the current thread
+			static std::string& acquire();
+
+		public:
+			//
+			// Constructors and destructors
+			//
+
+			// Acquire a free buffer of the current thread
+			OutputBuffer();
+
+			// Copy constructor
+			OutputBuffer(const OutputBuffer& other) = delete;
+
+			// Release the buffer, so it can be reused by the next message
+			~OutputBuffer();
+
+			//
+			// Overloaded operators
+			//
+
+			// Assignment operator
+			OutputBuffer& operator=(const OutputBuffer& other) = delete;
+
+			//
+			// Public methods
+			//
+
+			// Get the buffer
+			std::string& Get() noexcept;
+		};
+
+		//
+		// Constructors and destructors
+		//
+
+		// Acquire a free buffer of the current thread
+		inline OutputBuffer::OutputBuffer()
+			: m_Buffer(acquire())
+		{ }
+
+		// Release the buffer, so it can be reused by the next message
+		inline OutputBuffer::~OutputBuffer()
+		{
+			size_t* noBuffersInUse;
+			buffers(noBuffersInUse);
+			--*noBuffersInUse;
+
+			if (m_Buffer.capacity() > MAX_KEPT_CAPACITY)
+				std::string().swap(m_Buffer);
+		}
+
+		//
+		// Private methods
+		//
+
+		// Get the buffers of the current thread and the number of those which are in use
+		inline std::deque<std::string>& OutputBuffer::buffers(size_t*& noBuffersInUse) noexcept
+		{
+			static thread_local std::deque<std::string> threadBuffers;
+			static thread_local size_t threadBuffersInUse = 0u;
+
+			noBuffersInUse = &threadBuffersInUse;
+			return threadBuffers;
+		}
+
+		// Get a free buffer of the current thread
+		inline std::string& OutputBuffer::acquire()
+		{
+			size_t* noBuffersInUse;
+			std::deque<std::string>& threadBuffers = buffers(noBuffersInUse);
+
+			if (threadBuffers.size() == *noBuffersInUse)
+				threadBuffers.emplace_back();
+			std::string& buffer = threadBuffers[(*noBuffersInUse)++];
+			buffer.clear();
+
+			return buffer;
+		}
+
+		//
+		// Public methods
+		//
+
+		// Get the buffer
+		inline std::string& OutputBuffer::Get() noexcept
+		{
+			return m_Buffer;
+		}
+
+		// Bounded lock-free queue for multiple producers and consumers, whose slots (and their values) are reused
+		// (each slot has a sequence number telling whether it is free to be written or ready to be read for the current lap)
+		template<typename T>
+		class BoundedQueue
+		{
+			//
+			// Private members
+			//
+
+			struct Slot
+			{
+				std::atomic<size_t> sequence;
+				T value;
+			};
+
+			std::unique_ptr<Slot[]> m_Slots;
+			size_t m_Mask;
+			char m_EnqueuePadding[64];
+			std::atomic<size_t> m_EnqueuePosition;
+			char m_DequeuePadding[64];
+			std::atomic<size_t> m_DequeuePosition;
+			char m_EndPadding[64];
+
+		public:
+			//
+			// Constructors and destructors
+			//
+
+			// Creates a queue holding at least "capacity" values (rounded up to a power of two)
+			explicit BoundedQueue(size_t capacity);
+
+			// Copy constructor
+			BoundedQueue(const BoundedQueue& other) = delete;
+
+			//
+			// Overloaded operators
+			//
+
+			// Assignment operator
+			BoundedQueue& operator=(const BoundedQueue& other) = delete;
+
+			//
+			// Public methods
+			//
+
+			// Claim a free slot and call "write" with its value, returns false (without calling it) if the queue is full
+			template<typename TWrite>
+			bool TryPush(TWrite&& write);
+
+			// Claim the oldest ready slot and call "read" with its value, returns false (without calling it) if the queue is empty
+			template<typename TRead>
+			bool TryPop(TRead&& read);
+
+			// Check if no slot has been claimed for writing since the last one was read
+			bool Empty() const noexcept;
+
+			// Get the number of slots claimed for writing since the queue was created
+			size_t PushCount() const noexcept;
+
+			// Get the number of values the queue can hold
+			size_t Capacity() const noexcept;
+		};
+
+		//
+		// Constructors and destructors
+		//
+
+		// Creates a queue holding at least "capacity" values (rounded up to a power of two)
+		template<typename T>
+		inline BoundedQueue<T>::BoundedQueue(size_t capacity)
+			: m_Slots(), m_Mask(1u), m_EnqueuePosition(0u), m_DequeuePosition(0u)
+		{
+			while (m_Mask + 1u < capacity)
+				m_Mask = (m_Mask << 1u) | 1u;
+
+			m_Slots.reset(new Slot[m_Mask + 1u]);
+			for (size_t i = 0u; i <= m_Mask; ++i)
+				m_Slots[i].sequence.store(i, std::memory_order_relaxed);
+		}
+
+		//
+		// Public methods
+		//
+
+		// Claim a free slot and call "write" with its value, returns false (without calling it) if the queue is full
+		template<typename T>
+		template<typename TWrite>
+		inline bool BoundedQueue<T>::TryPush(TWrite&& write)
+		{
+			size_t position = m_EnqueuePosition.load(std::memory_order_relaxed);
+			Slot* slot;
+
+			for (;;)
+			{
+				slot = &m_Slots[position & m_Mask];
+				std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(slot->sequence.load(std::memory_order_acquire) - position);
+				if (difference == 0)
+				{
+					if (m_EnqueuePosition.compare_exchange_weak(position, position + 1u, std::memory_order_relaxed))
+						break;
+				}
+				else if (difference < 0)
+					return false;
+				else
+					position = m_EnqueuePosition.load(std::memory_order_relaxed);
+			}
+
+			write(slot->value);
+			slot->sequence.store(position + 1u, std::memory_order_release);
+			return true;
+		}
+
+		// Claim the oldest ready slot and call "read" with its value, returns false (without calling it) if the queue is empty
+		template<typename T>
+		template<typename TRead>
+		inline bool BoundedQueue<T>::TryPop(TRead&& read)
+		{
+			size_t position = m_DequeuePosition.load(std::memory_order_relaxed);
+			Slot* slot;
+
+			for (;;)
+			{
+				slot = &m_Slots[position & m_Mask];
+				std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(slot->sequence.load(std::memory_order_acquire) - (position + 1u));
+				if (difference == 0)
+				{
+					if (m_DequeuePosition.compare_exchange_weak(position, position + 1u, std::memory_order_relaxed))
+						break;
+				}
+				else if (difference < 0)
+					return false;
+				else
+					position = m_DequeuePosition.load(std::memory_order_relaxed);
+			}
+
+			read(slot->value);
+			slot->sequence.store(position + m_Mask + 1u, std::memory_order_release);
+			return true;
+		}
+
+		// Check if no slot has been claimed for writing since the last one was read
+		template<typename T>
+		inline bool BoundedQueue<T>::Empty() const noexcept
+		{
+			return m_EnqueuePosition.load(std::memory_order_relaxed) == m_DequeuePosition.load(std::memory_order_relaxed);
+		}
+
+		// Get the number of slots claimed for writing since the queue was created
+		template<typename T>
+		inline size_t BoundedQueue<T>::PushCount() const noexcept
+		{
+			return m_EnqueuePosition.load(std::memory_order_relaxed);
+		}
+
+		// Get the number of values the queue can hold
+		template<typename T>
+		inline size_t BoundedQueue<T>::Capacity() const noexcept
+		{
+			return m_Mask + 1u;
+		}
+
+		// Stream buffer tied to std::cin, writing the buffered output of STDOUT before input is read
+		class InputTie : public std::streambuf
+		{
+			//
+			// Private members
+			//
+
+			StreamSink& m_Sink;
+			std::ostream m_Stream;
+
+		protected:
+			//
+			// Protected methods
+			//
+
+			// Writes a character to std::cout
+			int overflow(int character) override;
+
+			// Writes "size" characters to std::cout
+			std::streamsize xsputn(const char* data, std::streamsize size) override;
+
+			// Writes the messages buffered by the sink, then flushes std::cout
+			int sync() override;
+
+		public:
+			//
+			// Constructors and destructors
+			//
+
+			// Ties std::cin to the stream, unless it was tied by the user to something other than std::cout, so that "sink" is written before reading input
+			explicit InputTie(StreamSink& sink);
+
+			// Copy constructor
+			InputTie(const InputTie& other) = delete;
+
+			// Ties std::cin back to std::cout
+			~InputTie() override;
+
+			//
+			// Overloaded operators
+			//
+
+			// Assignment operator
+			InputTie& operator=(const InputTie& other) = delete;
+		};
+
+		// Buffered output of a standard stream, shared by all the StreamLoggers writing to it so that their messages are never mixed
+		// (on POSIX systems the buffer is written to the file descriptor of the stream with a single write(2), otherwise through the C++ stream)
+		class StreamSink
+		{
+			//
+			// Private members
+			//
+
+			// Size of the buffer after which it is written, even if it was not flushed
+			static const size_t BUFFER_SIZE = 64u * 1024u;
+
+			std::mutex m_Mutex;
+			std::string m_Buffer;
+			std::ostream& m_Stream;
+			int m_Descriptor;
+			StreamSink* m_Tie;	// Sink flushed before this one is written (as std::cerr and std::clog are tied to std::cout)
+			std::atomic<bool> m_FlushOnNewLine;
+
+			//
+			// Private methods
+			//
+
+			// Writes the buffer to the stream, after the tied sink and anything written directly to the C++ stream (the mutex must be held)
+			void writeBuffer() noexcept;
+
+		public:
+			//
+			// Constructors and destructors
+			//
+
+			// Creates the sink of "stream", whose file descriptor is "descriptor", flushing at the end of every line if "flushOnNewLine" is true
+			// and flushing "tie" (if any) before being written
+			StreamSink(std::ostream& stream, int descriptor, bool flushOnNewLine, StreamSink* tie = nullptr) noexcept;
+
+			// Copy constructor
+			StreamSink(const StreamSink& other) = delete;
+
+			// Writes the messages left in the buffer
+			~StreamSink();
+
+			//
+			// Overloaded operators
+			//
+
+			// Assignment operator
+			StreamSink& operator=(const StreamSink& other) = delete;
+
+			//
+			// Public methods
+			//
+
+			// Get the sink of "streamType", created the first time it is used
+			static StreamSink& Get(StreamType streamType) noexcept;
+
+			// Appends "message" to the buffer, which is written if "flush" is true, the buffer is full or the message contains a newline (if set to flush on newline)
+			void Write(const std::string& message, bool flush);
+
+			// Writes the buffer to the stream
+			void Flush() noexcept;
+
+			// Set if the buffer is written after every message containing a newline
+			void SetFlushOnNewLine(bool flushOnNewLine) noexcept;
+
+			// Get if the buffer is written after every message containing a newline
+			bool GetFlushOnNewLine() const noexcept;
+		};
+
+		//
+		// Constructors and destructors
+		//
+
+		// Creates the sink of "stream", whose file descriptor is "descriptor", flushing at the end of every line if "flushOnNewLine" is true
+		// and flushing "tie" (if any) before being written
+		inline StreamSink::StreamSink(std::ostream& stream, int descriptor, bool flushOnNewLine, StreamSink* tie) noexcept
+			: m_Mutex(), m_Buffer(), m_Stream(stream), m_Descriptor(descriptor), m_Tie(tie), m_FlushOnNewLine(flushOnNewLine)
+		{ }
+
+		// Writes the messages left in the buffer
+		inline StreamSink::~StreamSink()
+		{
+			Flush();
+		}
+
+		//
+		// Private methods
+		//
+
+		// Writes the buffer to the stream, after the tied sink and anything written directly to the C++ stream (the mutex must be held)
+		inline void StreamSink::writeBuffer() noexcept
+		{
+			if (m_Buffer.empty())
+				return;
+
+			if (m_Tie != nullptr)
+				m_Tie->Flush();
+#ifdef SBLOGGER_NIX
+			m_Stream.flush();
+
+			const char* data = m_Buffer.data();
+			size_t size = m_Buffer.size();
+			while (size > 0u)
+			{
+				const ssize_t written = ::write(m_Descriptor, data, size);
+				if (written < 0)
+				{
+					if (errno == EINTR)
+						continue;
+					break;
+				}
+
+				data += written;
+				size -= static_cast<size_t>(written);
+			}
+#else
+			m_Stream.write(m_Buffer.data(), static_cast<std::streamsize>(m_Buffer.size()));
+			m_Stream.flush();
+#endif
+			m_Buffer.clear();
+		}
+
+		//
+		// Public methods
+		//
+
+		// Get the sink of "streamType", created the first time it is used
+		inline StreamSink& StreamSink::Get(StreamType streamType) noexcept
+		{
+			// Error messages are written right away, the other streams only flushing on newline when written to a terminal
+#ifdef SBLOGGER_NIX
+			static StreamSink stdoutSink(std::cout, STDOUT_FILENO, ::isatty(STDOUT_FILENO) != 0);
+			static StreamSink stderrSink(std::cerr, STDERR_FILENO, true, &stdoutSink);
+			static StreamSink stdlogSink(std::clog, STDERR_FILENO, ::isatty(STDERR_FILENO) != 0, &stdoutSink);
+#else
+			static StreamSink stdoutSink(std::cout, 1, true);
+			static StreamSink stderrSink(std::cerr, 2, true, &stdoutSink);
+			static StreamSink stdlogSink(std::clog, 2, true, &stdoutSink);
+#endif
+			// Prompts written without a newline are shown before std::cin waits for input, as when writing to std::cout
+			static InputTie inputTie(stdoutSink);
+
+			switch (streamType)
+			{
+			case StreamType::STDERR:	return stderrSink;
+			case StreamType::STDLOG:	return stdlogSink;
+			default:					return stdoutSink;
+			}
+		}
+
+		// Appends "message" to the buffer, which is written if "flush" is true, the buffer is full or the message contains a newline (if set to flush on newline)
+		inline void StreamSink::Write(const std::string& message, bool flush)
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+
+			m_Buffer.append(message);
+			if (flush || m_Buffer.size() >= BUFFER_SIZE || (m_FlushOnNewLine.load(std::memory_order_relaxed) && message.find('\n') != std::string::npos))
+				writeBuffer();
+		}
+
+		// Writes the buffer to the stream
+		inline void StreamSink::Flush() noexcept
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+
+			writeBuffer();
+		}
+
+		// Set if the buffer is written after every message containing a newline
+		inline void StreamSink::SetFlushOnNewLine(bool flushOnNewLine) noexcept
+		{
+			m_FlushOnNewLine.store(flushOnNewLine, std::memory_order_relaxed);
+		}
+
+		// Get if the buffer is written after every message containing a newline
+		inline bool StreamSink::GetFlushOnNewLine() const noexcept
+		{
+			return m_FlushOnNewLine.load(std::memory_order_relaxed);
+		}
+
+		//
+		// Constructors and destructors
+		//
+
+		// Ties std::cin to the stream, unless it was tied by the user to something other than std::cout, so that "sink" is written before reading input
+		inline InputTie::InputTie(StreamSink& sink)
+			: std::streambuf(), m_Sink(sink), m_Stream(this)
+		{
+			if (std::cin.tie() == &std::cout)
+				std::cin.tie(&m_Stream);
+		}
+
+		// Ties std::cin back to std::cout
+		inline InputTie::~InputTie()
+		{
+			if (std::cin.tie() == &m_Stream)
+				std::cin.tie(&std::cout);
+		}
+
+		//
+		// Protected methods
+		//
+
+		// Writes a character to std::cout
+		inline int InputTie::overflow(int character)
+		{
+			if (traits_type::eq_int_type(character, traits_type::eof()))
+				return traits_type::not_eof(character);
+
+			return std::cout.rdbuf()->sputc(traits_type::to_char_type(character));
+		}
+
+		// Writes "size" characters to std::cout
+		inline std::streamsize InputTie::xsputn(const char* data, std::streamsize size)
+		{
+			return std::cout.rdbuf()->sputn(data, size);
+		}
+
+		// Writes the messages buffered by the sink, then flushes std::cout
+		inline int InputTie::sync()
+		{
+			m_Sink.Flush();
+			std::cout.flush();
+
+			return 0;
+		}
+
+		// Output of a FileLogger: a file opened for appending, written from a user-space buffer once it is full or flushed
+		// (on POSIX systems using the file descriptor, the buffer and a larger message being written together by writev(2), otherwise using a std::FILE)
+		class FileSink
+		{
+			//
+			// Private members
+			//
+
+			// Size of the buffer used by default
+			static const size_t DEFAULT_BUFFER_SIZE = 64u * 1024u;
+
+#ifdef SBLOGGER_NIX
+			int m_Descriptor;
+#else
+			std::FILE* m_File;
+#endif
+			std::string m_Buffer;
+			size_t m_BufferSize;
+			size_t m_Size;
+
+			//
+			// Private methods
+			//
+
+			// Writes the buffer followed by "data" (of "size" characters) to the file, then empties the buffer
+			void writeBuffer(const char* data, size_t size) noexcept;
+
+		public:
+			//
+			// Constructors and destructors
+			//
+
+			// Creates a sink with no file opened
+			FileSink() noexcept;
+
+			// Copy constructor
+			FileSink(const FileSink& other) = delete;
+
+			// Writes the buffer and closes the file
+			~FileSink();
+
+			//
+			// Overloaded operators
+			//
+
+			// Assignment operator
+			FileSink& operator=(const FileSink& other) = delete;
+
+			//
+			// Public methods
+			//
+
+			// Opens the file found at "filePath" for appending (emptying it first if "truncate" is true), after closing the one opened before
+			// Returns false if the file could not be opened
+			bool Open(const std::string& filePath, bool truncate) noexcept;
+
+			// Writes the buffer and closes the file
+			void Close() noexcept;
+
+			// Check if a file is opened
+			bool IsOpen() const noexcept;
+
+			// Exchanges the files (and the messages buffered for them) of the two sinks, keeping their buffer sizes
+			void Swap(FileSink& other) noexcept;
+
+			// Get the size of the file, including the messages still buffered (counted by the sink, from the size the file had when opened)
+			size_t GetSize() const noexcept;
+
+			// Appends "message" to the buffer, writing it to the file if "flush" is true or the buffer is full
+			void Write(const std::string& message, bool flush);
+
+			// Writes the buffer to the file
+			void Flush() noexcept;
+
+			// Writes the buffer to the file and waits until its data is stored on the disk (using fdatasync on POSIX systems)
+			void Sync() noexcept;
+
+			// Set the number of characters buffered before being written to the file (0 to write every message right away)
+			void SetBufferSize(size_t bufferSize) noexcept;
+
+			// Get the number of characters buffered before being written to the file
+			size_t GetBufferSize() const noexcept;
+
+			// Reserve "size" bytes of disk space after the end of the file (without changing its size) and advise the system that it is written sequentially
+			// Returns false if not supported (only on Linux) or if the space could not be reserved
+			bool Preallocate(size_t size) noexcept;
+		};
+
+		//
+		// Constructors and destructors
+		//
+
+		// Creates a sink with no file opened
+		inline FileSink::FileSink() noexcept
+#ifdef SBLOGGER_NIX
+			: m_Descriptor(-1), m_Buffer(), m_BufferSize(DEFAULT_BUFFER_SIZE), m_Size(0u)
+#else
+			: m_File(nullptr), m_Buffer(), m_BufferSize(DEFAULT_BUFFER_SIZE), m_Size(0u)
+#endif
+		{ }
+
+		// Writes the buffer and closes the file
+		inline FileSink::~FileSink()
+		{
+			Close();
+		}
+
+		//
+		// Private methods
+		//
+
+		// Writes the buffer followed by "data" (of "size" characters) to the file, then empties the buffer
+		inline void FileSink::writeBuffer(const char* data, size_t size) noexcept
+		{
+#ifdef SBLOGGER_NIX
+			iovec parts[2];
+			iovec* part = parts;
+			int noParts = 0;
+
+			if (!m_Buffer.empty())
+				parts[noParts++] = { const_cast<char*>(m_Buffer.data()), m_Buffer.size() };
+			if (size > 0u)
+				parts[noParts++] = { const_cast<char*>(data), size };
+
+			while (noParts > 0)
+			{
+				ssize_t written = ::writev(m_Descriptor, part, noParts);
+				if (written < 0)
+				{
+					if (errno == EINTR)
+						continue;
+					break;
+				}
+
+				// Skip what was written (writes of regular files are rarely partial)
+				while (noParts > 0 && static_cast<size_t>(written) >= part->iov_len)
+				{
+					written -= static_cast<ssize_t>(part->iov_len);
+					++part;
+					--noParts;
+				}
+				if (noParts > 0)
+				{
+					part->iov_base = static_cast<char*>(part->iov_base) + written;
+					part->iov_len -= static_cast<size_t>(written);
+				}
+			}
+#else
+			std::fwrite(m_Buffer.data(), 1u, m_Buffer.size(), m_File);
+			std::fwrite(data, 1u, size, m_File);
+			std::fflush(m_File);
+#endif
+			m_Buffer.clear();
+		}
+
+		//
+		// Public methods
+		//
+
+		// Opens the file found at "filePath" for appending (emptying it first if "truncate" is true), after closing the one opened before
+		// Returns false if the file could not be opened
+		inline bool FileSink::Open(const std::string& filePath, bool truncate) noexcept
+		{
+			Close();
+
+			m_Size = 0u;
+#ifdef SBLOGGER_NIX
+			do
+				m_Descriptor = ::open(filePath.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC | (truncate ? O_TRUNC : 0), 0666);
+			while (m_Descriptor < 0 && errno == EINTR);
+
+			const off_t end = IsOpen() ? ::lseek(m_Descriptor, 0, SEEK_END) : -1;
+			if (end > 0)
+				m_Size = static_cast<size_t>(end);
+#else
+			m_File = std::fopen(filePath.c_str(), truncate ? "wb" : "ab");
+			if (m_File != nullptr)
+			{
+				std::setvbuf(m_File, nullptr, _IONBF, 0u);
+				if (std::fseek(m_File, 0, SEEK_END) == 0 && std::ftell(m_File) > 0)
+					m_Size = static_cast<size_t>(std::ftell(m_File));
+			}
+#endif
+
+			return IsOpen();
+		}
+
+		// Writes the buffer and closes the file
+		inline void FileSink::Close() noexcept
+		{
+			if (!IsOpen())
+				return;
+
+			Flush();
+#ifdef SBLOGGER_NIX
+			::close(m_Descriptor);
+			m_Descriptor = -1;
+#else
+			std::fclose(m_File);
+			m_File = nullptr;
+#endif
+		}
+
+		// Check if a file is opened
+		inline bool FileSink::IsOpen() const noexcept
+		{
+#ifdef SBLOGGER_NIX
+			return m_Descriptor >= 0;
+#else
+			return m_File != nullptr;
+#endif
+		}
+
+		// Exchanges the files (and the messages buffered for them) of the two sinks, keeping their buffer sizes
+		inline void FileSink::Swap(FileSink& other) noexcept
+		{
+#ifdef SBLOGGER_NIX
+			std::swap(m_Descriptor, other.m_Descriptor);
+#else
+			std::swap(m_File, other.m_File);
+#endif
+			m_Buffer.swap(other.m_Buffer);
+			std::swap(m_Size, other.m_Size);
+		}
+
+		// Get the size of the file, including the messages still buffered (counted by the sink, from the size the file had when opened)
+		inline size_t FileSink::GetSize() const noexcept
+		{
+			return m_Size;
+		}
+
+		// Appends "message" to the buffer, writing it to the file if "flush" is true or the buffer is full
+		inline void FileSink::Write(const std::string& message, bool flush)
+		{
+			m_Size += message.size();
+
+			// Messages which do not fit are written together with the buffer, instead of being copied into it
+			if (flush || m_Buffer.size() + message.size() > m_BufferSize)
+				writeBuffer(message.data(), message.size());
+			else
+				m_Buffer.append(message);
+		}
+
+		// Writes the buffer to the file
+		inline void FileSink::Flush() noexcept
+		{
+			if (IsOpen() && !m_Buffer.empty())
+				writeBuffer(nullptr, 0u);
+		}
+
+		// Writes the buffer to the file and waits until its data is stored on the disk (using fdatasync on POSIX systems)
+		inline void FileSink::Sync() noexcept
+		{
+			if (!IsOpen())
+				return;
+
+			Flush();
+#if defined SBLOGGER_NIX && defined __APPLE__
+			::fsync(m_Descriptor);
+#elif defined SBLOGGER_NIX
+			::fdatasync(m_Descriptor);
+#else
+			std::fflush(m_File);
+#endif
+		}
+
+		// Set the number of characters buffered before being written to the file (0 to write every message right away)
+		inline void FileSink::SetBufferSize(size_t bufferSize) noexcept
+		{
+			if (m_Buffer.size() > bufferSize)
+				Flush();
+			m_BufferSize = bufferSize;
+		}
+
+		// Get the number of characters buffered before being written to the file
+		inline size_t FileSink::GetBufferSize() const noexcept
+		{
+			return m_BufferSize;
+		}
+
+		// Reserve "size" bytes of disk space after the end of the file (without changing its size) and advise the system that it is written sequentially
+		// Returns false if not supported (only on Linux) or if the space could not be reserved
+		inline bool FileSink::Preallocate(size_t size) noexcept
+		{
+#if defined __linux__ && defined FALLOC_FL_KEEP_SIZE
+			if (!IsOpen())
+				return false;
+
+			const off_t end = ::lseek(m_Descriptor, 0, SEEK_END);
+			::posix_fadvise(m_Descriptor, 0, 0, POSIX_FADV_SEQUENTIAL);
+			return end >= 0 && ::fallocate(m_Descriptor, FALLOC_FL_KEEP_SIZE, end, static_cast<off_t>(size)) == 0;
+#else
+			(void)size;
+			return false;
+#endif
+		}
+
+		// Background thread shared by all the loggers, running their timed tasks (e.g. changing the file of a DailyLogger, flushing a FileLogger periodically)
+		// The tasks are kept in a min-heap of their times, indexed by task so that adding and removing one takes O(log n)
+		class Scheduler
+		{
+		public:
+			// Run at the time of a task, getting that time and returning the next one (or a default constructed time point, to end the task)
+			using Callback = std::function<std::chrono::system_clock::time_point(std::chrono::system_clock::time_point)>;
+
+		private:
+			//
+			// Private members
+			//
+
+			// Position of a task which is not in the heap (being run or ended)
+			static const size_t NO_POSITION = static_cast<size_t>(-1);
+
+			// Scheduled task, identified by its index + 1 (kept until removed, even once ended, so that its identifier is not reused before)
+			struct Task
+			{
+				std::chrono::system_clock::time_point time;
+				Callback callback;
+				size_t position;
+				bool isFree;
+			};
+
+			std::mutex m_Mutex;
+			std::condition_variable m_WakeUp;
+			std::condition_variable m_TaskDone;
+			std::thread m_Thread;
+			std::vector<Task> m_Tasks;
+			std::vector<size_t> m_Heap;
+			std::vector<size_t> m_FreeIds;
+			size_t m_RunningId;
+			bool m_RunningRemoved;
+			std::chrono::system_clock::time_point m_RunningRescheduled;
+			bool m_Stop;
+
+			//
+			// Private methods
+			//
+
+			// Check if the task at "first" in the heap is due before the one at "second"
+			bool isEarlier(size_t first, size_t second) const noexcept;
+
+			// Exchanges the tasks at "first" and "second" in the heap, updating their positions
+			void swapPositions(size_t first, size_t second) noexcept;
+
+			// Moves the task at "position" up the heap, until its parent is due before it
+			void siftUp(size_t position) noexcept;
+
+			// Moves the task at "position" down the heap, until it is due before its children
+			void siftDown(size_t position) noexcept;
+
+			// Adds the task "id" to the heap, at the time it is set to
+			void push(size_t id);
+
+			// Removes the task at "position" from the heap
+			void removeAt(size_t position) noexcept;
+
+			// Frees the task "id", so that its identifier can be reused
+			void release(size_t id) noexcept;
+
+			// Runs the tasks at their times, until the scheduler is destroyed
+			void run();
+
+		public:
+			//
+			// Constructors and destructors
+			//
+
+			// Creates a scheduler with no tasks (its thread being started when the first task is added)
+			Scheduler() noexcept;
+
+			// Copy constructor
+			Scheduler(const Scheduler& other) = delete;
+
+			// Stops the thread, the tasks left being discarded
+			~Scheduler();
+
+			//
+			// Overloaded operators
+			//
+
+			// Assignment operator
+			Scheduler& operator=(const Scheduler& other) = delete;
+
+			//
+			// Public methods
+			//
+
+			// Get the scheduler shared by all the loggers, created the first time it is used (loggers using it should call this from their constructors, so
+			// that it is destroyed after them)
+			static Scheduler& Get() noexcept;
+
+			// Schedules "callback" to run at "time" (and then at the times it returns), returning the identifier of the task (never 0)
+			size_t Add(std::chrono::system_clock::time_point time, Callback callback);
+
+			// Removes the task "id", waiting for it to end if it is running (unless called from the task itself)
+			void Remove(size_t id);
+
+			// Set the time the task "id" is run at next (restarting it if it has ended), without waiting for it if it is running
+			void Reschedule(size_t id, std::chrono::system_clock::time_point time);
+
+			// Get the number of tasks added and not yet removed
+			size_t GetTaskCount();
+		};
+
+		//
+		// Constructors and destructors
+		//
+
+		// Creates a scheduler with no tasks (its thread being started when the first task is added)
+		inline Scheduler::Scheduler() noexcept
+			: m_Mutex(), m_WakeUp(), m_TaskDone(), m_Thread(), m_Tasks(), m_Heap(), m_FreeIds(), m_RunningId(0u), m_RunningRemoved(false), m_RunningRescheduled(), m_Stop(false)
+		{ }
+
+		// Stops the thread, the tasks left being discarded
+		inline Scheduler::~Scheduler()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_Mutex);
+				m_Stop = true;
+				m_WakeUp.notify_all();
+			}
+
+			if (m_Thread.joinable())
+				m_Thread.join();
+		}
+
+		//
+		// Private methods
+		//
+
+		// Check if the task at "first" in the heap is due before the one at "second"
+		inline bool Scheduler::isEarlier(size_t first, size_t second) const noexcept
+		{
+			return m_Tasks[m_Heap[first] - 1u].time < m_Tasks[m_Heap[second] - 1u].time;
+		}
+
+		// Exchanges the tasks at "first" and "second" in the heap, updating their positions
+		inline void Scheduler::swapPositions(size_t first, size_t second) noexcept
+		{
+			std::swap(m_Heap[first], m_Heap[second]);
+			m_Tasks[m_Heap[first] - 1u].position = first;
+			m_Tasks[m_Heap[second] - 1u].position = second;
+		}
+
+		// Moves the task at "position" up the heap, until its parent is due before it
+		inline void Scheduler::siftUp(size_t position) noexcept
+		{
+			while (position > 0u && isEarlier(position, (position - 1u) / 2u))
+			{
+				swapPositions(position, (position - 1u) / 2u);
+				position = (position - 1u) / 2u;
+			}
+		}
+
+		// Moves the task at "position" down the heap, until it is due before its children
+		inline void Scheduler::siftDown(size_t position) noexcept
+		{
+			for (;;)
+			{
+				size_t earliest = position;
+				const size_t left = 2u * position + 1u, right = left + 1u;
+
+				if (left < m_Heap.size() && isEarlier(left, earliest))
+					earliest = left;
+				if (right < m_Heap.size() && isEarlier(right, earliest))
+					earliest = right;
+				if (earliest == position)
+					return;
+
+				swapPositions(position, earliest);
+				position = earliest;
+			}
+		}
+
+		// Adds the task "id" to the heap, at the time it is set to
+		inline void Scheduler::push(size_t id)
+		{
+			m_Tasks[id - 1u].position = m_Heap.size();
+			m_Heap.push_back(id);
+			siftUp(m_Heap.size() - 1u);
+		}
+
+		// Removes the task at "position" from the heap
+		inline void Scheduler::removeAt(size_t position) noexcept
+		{
+			const size_t last = m_Heap.size() - 1u;
+
+			m_Tasks[m_Heap[position] - 1u].position = NO_POSITION;
+			if (position != last)
+			{
+				m_Heap[position] = m_Heap[last];
+				m_Tasks[m_Heap[position] - 1u].position = position;
+			}
+			m_Heap.pop_back();
+
+			// The task moved into its place can be due either before its new parent or after its new children
+			if (position < m_Heap.size())
+			{
+				const size_t moved = m_Heap[position];
+				siftUp(position);
+				siftDown(m_Tasks[moved - 1u].position);
+			}
+		}
+
+		// Frees the task "id", so that its identifier can be reused
+		inline void Scheduler::release(size_t id) noexcept
+		{
+			m_Tasks[id - 1u].isFree = true;
+			m_FreeIds.push_back(id);
+		}
+
+		// Runs the tasks at their times, until the scheduler is destroyed
+		inline void Scheduler::run()
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+
+			while (!m_Stop)
+			{
+				if (m_Heap.empty())
+				{
+					m_WakeUp.wait(lock);
+					continue;
+				}
+
+				// Also checking the time after waking up, since the wait can end early (e.g. if the system clock is changed or a task is added)
+				const size_t id = m_Heap.front();
+				const std::chrono::system_clock::time_point time = m_Tasks[id - 1u].time;
+				if (std::chrono::system_clock::now() < time)
+				{
+					m_WakeUp.wait_until(lock, time);
+					continue;
+				}
+
+				removeAt(0u);
+				m_RunningId = id;
+				m_RunningRemoved = false;
+				m_RunningRescheduled = std::chrono::system_clock::time_point();
+				Callback callback(std::move(m_Tasks[id - 1u].callback));
+				lock.unlock();
+
+				std::chrono::system_clock::time_point nextTime;
+				try
+				{
+					nextTime = callback(time);
+				}
+				catch (...)
+				{
+					nextTime = std::chrono::system_clock::time_point();
+				}
+
+				lock.lock();
+				if (m_RunningRescheduled != std::chrono::system_clock::time_point() && (nextTime == std::chrono::system_clock::time_point() || m_RunningRescheduled < nextTime))
+					nextTime = m_RunningRescheduled;
+				if (m_RunningRemoved)
+				{
+					// Destroy the callback before "Remove" returns, as it may refer to the one removing it
+					callback = nullptr;
+					release(id);
+				}
+				else
+				{
+					// Ended tasks keep their callback, so that they can be rescheduled
+					m_Tasks[id - 1u].callback = std::move(callback);
+					if (nextTime != std::chrono::system_clock::time_point())
+					{
+						m_Tasks[id - 1u].time = nextTime;
+						push(id);
+					}
+				}
+				m_RunningId = 0u;
+				m_TaskDone.notify_all();
+			}
+		}
+
+		//
+		// Public methods
+		//
+
+		// Get the scheduler shared by all the loggers, created the first time it is used (loggers using it should call this from their constructors, so
+		// that it is destroyed after them)
+		inline Scheduler& Scheduler::Get() noexcept
+		{
+			static Scheduler scheduler;
+			return scheduler;
+		}
+
+		// Schedules "callback" to run at "time" (and then at the times it returns), returning the identifier of the task (never 0)
+		inline size_t Scheduler::Add(std::chrono::system_clock::time_point time, Callback callback)
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			size_t id;
+
+			if (m_FreeIds.empty())
+				m_Tasks.push_back(Task{ time, nullptr, NO_POSITION, true });
+			// Reserve the space for all the tasks, so that adding them to the heap or freeing them never throws
+			m_Heap.reserve(m_Tasks.size());
+			m_FreeIds.reserve(m_Tasks.size());
+
+			if (m_FreeIds.empty())
+				id = m_Tasks.size();
+			else
+			{
+				id = m_FreeIds.back();
+				m_FreeIds.pop_back();
+			}
+
+			m_Tasks[id - 1u].time = time;
+			m_Tasks[id - 1u].callback = std::move(callback);
+			m_Tasks[id - 1u].isFree = false;
+			push(id);
+
+			if (!m_Thread.joinable())
+				m_Thread = std::thread(&Scheduler::run, this);
+			// Only wake the thread if the new task is due before the one it waits for
+			else if (m_Tasks[id - 1u].position == 0u)
+				m_WakeUp.notify_all();
+
+			return id;
+		}
+
+		// Removes the task "id", waiting for it to end if it is running (unless called from the task itself)
+		inline void Scheduler::Remove(size_t id)
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+
+			if (id == 0u || id > m_Tasks.size() || m_Tasks[id - 1u].isFree)
+				return;
+
+			if (id == m_RunningId)
+			{
+				m_RunningRemoved = true;
+				if (std::this_thread::get_id() != m_Thread.get_id())
+					m_TaskDone.wait(lock, [this, id]() { return m_RunningId != id; });
+				return;
+			}
+
+			// Ended tasks are no longer in the heap
+			if (m_Tasks[id - 1u].position != NO_POSITION)
+				removeAt(m_Tasks[id - 1u].position);
+			m_Tasks[id - 1u].callback = nullptr;
+			release(id);
+		}
+
+		// Set the time the task "id" is run at next (restarting it if it has ended), without waiting for it if it is running
+		inline void Scheduler::Reschedule(size_t id, std::chrono::system_clock::time_point time)
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+
+			if (id == 0u || id > m_Tasks.size() || m_Tasks[id - 1u].isFree)
+				return;
+
+			// The running task is rescheduled once it returns, at the earliest of the two times
+			if (id == m_RunningId)
+			{
+				if (m_RunningRescheduled == std::chrono::system_clock::time_point() || time < m_RunningRescheduled)
+					m_RunningRescheduled = time;
+				return;
+			}
+
+			m_Tasks[id - 1u].time = time;
+			if (m_Tasks[id - 1u].position == NO_POSITION)
+				push(id);
+			else
+			{
+				siftUp(m_Tasks[id - 1u].position);
+				siftDown(m_Tasks[id - 1u].position);
+			}
+
+			if (m_Tasks[id - 1u].position == 0u)
+				m_WakeUp.notify_all();
+		}
+
+		// Get the number of tasks added and not yet removed
+		inline size_t Scheduler::GetTaskCount()
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			return m_Tasks.size() - m_FreeIds.size();
+		}
+
+		// Background thread shared by all the loggers, compressing the files closed by rotating loggers one at a time, at a low priority and reading at most
+		// a given number of bytes per second, so that it does not compete with the loggers writing. Files are compressed to the LZ4 frame format (using
+		// the bundled compressor) or, if "SBLOGGER_ZLIB" is defined, to the gzip format
+		class Compressor
+		{
+		public:
+			// File to compress
+			struct Job
+			{
+				std::FILE* source;
+				std::string sourcePath;
+				std::string outputPath;
+				Compression compression;
+				const void* owner;
+
+				// Called once the file is compressed (or failed to be), with the size of the output, instead of deleting the source (if set)
+				std::function<void(bool, size_t)> done;
+			};
+
+		private:
+			//
+			// Private members
+			//
+
+			// Size of the blocks read from the files (also the maximum size of the LZ4 blocks)
+			static const size_t BLOCK_SIZE = 64u * 1024u;
+
+			// Number of bytes read per second by default
+			static const size_t DEFAULT_RATE = 8u * 1024u * 1024u;
+
+			std::mutex m_Mutex;
+			std::condition_variable m_WakeUp;
+			std::condition_variable m_JobDone;
+			std::thread m_Thread;
+			std::deque<Job> m_Jobs;
+			const void* m_RunningOwner;
+			std::atomic<size_t> m_Rate;
+			std::atomic<bool> m_Stop;
+
+			//
+			// Private methods
+			//
+
+			// Get the xxHash32 (with a seed of 0) of "data", of "size" bytes (shorter than 16 bytes, as only used for the LZ4 frame header)
+			static std::uint32_t xxHash32(const unsigned char* data, size_t size) noexcept;
+
+			// Appends "value" to "output" in little endian order, returning the position after it
+			static unsigned char* writeLittleEndian(unsigned char* output, std::uint32_t value) noexcept;
+
+			// Compresses "size" bytes of "source" (at most BLOCK_SIZE) to an LZ4 block, returning its size
+			// ("output" must hold at least "size + size / 255 + 16" bytes)
+			static size_t compressBlock(const unsigned char* source, size_t size, unsigned char* output) noexcept;
+
+			// Reads the next block of "source" into "buffer" (after waiting for the number of bytes read so far, "noRead", to be allowed by the rate,
+			// unless the compressor is being destroyed), returns 0 at the end of the file
+			size_t readBlock(std::FILE* source, unsigned char* buffer, size_t& noRead, std::chrono::steady_clock::time_point start);
+
+			// Compresses "source" to "output" using the LZ4 frame format, returns false if it could not be written
+			bool compressLz4(std::FILE* source, std::FILE* output);
+
+			// Compresses "source" to "output" using the gzip format, returns false if it could not be written
+			bool compressGzip(std::FILE* source, std::FILE* output);
+
+			// Compresses the file of "job" to a temporary file, renamed to its output path if successful, returns the size of the output (0 if not compressed)
+			size_t compress(const Job& job);
+
+			// Compresses the files added, until the compressor is destroyed and all of them are compressed
+			void run();
+
+		public:
+			//
+			// Constructors and destructors
+			//
+
+			// Creates a compressor with no files to compress (its thread being started when the first file is added)
+			Compressor() noexcept;
+
+			// Copy constructor
+			Compressor(const Compressor& other) = delete;
+
+			// Compresses the files left (without limiting the rate), then stops the thread
+			~Compressor();
+
+			//
+			// Overloaded operators
+			//
+
+			// Assignment operator
+			Compressor& operator=(const Compressor& other) = delete;
+
+			//
+			// Public methods
+			//
+
+			// Get the compressor shared by all the loggers, created the first time it is used (loggers using it should call this from their constructors,
+			// so that it is destroyed after them)
+			static Compressor& Get() noexcept;
+
+			// Get the extension added to the files compressed using "compression" (ex.: ".gz")
+			static const char* GetExtension(Compression compression) noexcept;
+
+			// Adds a file to compress (its source is closed by the compressor)
+			void Add(Job job);
+
+			// Removes the files added by "owner", waiting for the one being compressed (if any)
+			void Cancel(const void* owner);
+
+			// Set the maximum number of bytes read per second (0 for no limit)
+			void SetRate(size_t bytesPerSecond) noexcept;
+
+			// Get the maximum number of bytes read per second
+			size_t GetRate() const noexcept;
+		};
+
+		//
+		// Constructors and destructors
+		//
+
+		// Creates a compressor with no files to compress (its thread being started when the first file is added)
+		inline Compressor::Compressor() noexcept
+			: m_Mutex(), m_WakeUp(), m_JobDone(), m_Thread(), m_Jobs(), m_RunningOwner(nullptr), m_Rate(DEFAULT_RATE), m_Stop(false)
+		{ }
+
+		// Compresses the files left (without limiting the rate), then stops the thread
+		inline Compressor::~Compressor()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_Mutex);
+				m_Stop = true;
+				m_WakeUp.notify_all();
+			}
+
+			if (m_Thread.joinable())
+				m_Thread.join();
+		}
+
+		//
+		// Private methods
+		//
+
+		// Get the xxHash32 (with a seed of 0) of "data", of "size" bytes (shorter than 16 bytes, as only used for the LZ4 frame header)
+		inline std::uint32_t Compressor::xxHash32(const unsigned char* data, size_t size) noexcept
+		{
+			const std::uint32_t PRIME1 = 2654435761u, PRIME2 = 2246822519u, PRIME3 = 3266489917u, PRIME4 = 668265263u, PRIME5 = 374761393u;
+			std::uint32_t hash = PRIME5 + static_cast<std::uint32_t>(size);
+			size_t index = 0u;
+
+			for (; index + 4u <= size; index += 4u)
+			{
+				hash += (static_cast<std::uint32_t>(data[index]) | static_cast<std::uint32_t>(data[index + 1u]) << 8 | static_cast<std::uint32_t>(data[index + 2u]) << 16
+					| static_cast<std::uint32_t>(data[index + 3u]) << 24) * PRIME3;
+				hash = (hash << 17 | hash >> 15) * PRIME4;
+			}
+			for (; index < size; ++index)
+			{
+				hash += data[index] * PRIME5;
+				hash = (hash << 11 | hash >> 21) * PRIME1;
+			}
+
+			hash ^= hash >> 15;
+			hash *= PRIME2;
+			hash ^= hash >> 13;
+			hash *= PRIME3;
+			hash ^= hash >> 16;
+			return hash;
+		}
+
+		// Appends "value" to "output" in little endian order, returning the position after it
+		inline unsigned char* Compressor::writeLittleEndian(unsigned char* output, std::uint32_t value) noexcept
+		{
+			for (int byte = 0; byte < 4; ++byte)
+				*output++ = static_cast<unsigned char>(value >> (8 * byte));
+			return output;
+		}
+
+		// Compresses "size" bytes of "source" (at most BLOCK_SIZE) to an LZ4 block, returning its size
+		// ("output" must hold at least "size + size / 255 + 16" bytes)
+		inline size_t Compressor::compressBlock(const unsigned char* source, size_t size, unsigned char* output) noexcept
+		{
+			// A block ends with at least 5 literals and its last match starts at least 12 bytes before its end
+			const size_t MIN_MATCH = 4u, LAST_LITERALS = 5u, MATCH_FIND_LIMIT = 12u, HASH_BITS = 12u;
+			std::uint32_t positions[1u << HASH_BITS] = {};
+			unsigned char* out = output;
+			size_t anchor = 0u, position = 0u;
+
+			// Writes the literals since "anchor" followed by the match (if "matchLength" is not 0)
+			auto writeSequence = [&out, source](size_t anchor, size_t position, size_t offset, size_t matchLength)
+			{
+				size_t noLiterals = position - anchor;
+				unsigned char* token = out++;
+
+				*token = static_cast<unsigned char>((noLiterals < 15u ? noLiterals : 15u) << 4);
+				if (noLiterals >= 15u)
+				{
+					for (noLiterals -= 15u; noLiterals >= 255u; noLiterals -= 255u)
+						*out++ = 255u;
+					*out++ = static_cast<unsigned char>(noLiterals);
+				}
+				std::memcpy(out, source + anchor, position - anchor);
+				out += position - anchor;
+
+				if (matchLength == 0u)
+					return;
+
+				*out++ = static_cast<unsigned char>(offset);
+				*out++ = static_cast<unsigned char>(offset >> 8);
+				matchLength -= MIN_MATCH;
+				*token |= static_cast<unsigned char>(matchLength < 15u ? matchLength : 15u);
+				if (matchLength >= 15u)
+				{
+					for (matchLength -= 15u; matchLength >= 255u; matchLength -= 255u)
+						*out++ = 255u;
+					*out++ = static_cast<unsigned char>(matchLength);
+				}
+			};
+
+			while (position + MATCH_FIND_LIMIT <= size)
+			{
+				std::uint32_t sequence;
+				std::memcpy(&sequence, source + position, sizeof(sequence));
+				const std::uint32_t hash = (sequence * 2654435761u) >> (32u - HASH_BITS);
+				const size_t candidate = positions[hash];
+				positions[hash] = static_cast<std::uint32_t>(position);
+
+				if (candidate >= position || std::memcmp(source + candidate, source + position, MIN_MATCH) != 0)
+				{
+					++position;
+					continue;
+				}
+
+				size_t matchEnd = position + MIN_MATCH;
+				while (matchEnd < size - LAST_LITERALS && source[matchEnd] == source[candidate + (matchEnd - position)])
+					++matchEnd;
+
+				writeSequence(anchor, position, position - candidate, matchEnd - position);
+				position = anchor = matchEnd;
+			}
+
+			writeSequence(anchor, size, 0u, 0u);
+			return static_cast<size_t>(out - output);
+		}
+
+		// Reads the next block of "source" into "buffer" (after waiting for the number of bytes read so far, "noRead", to be allowed by the rate,
+		// unless the compressor is being destroyed), returns 0 at the end of the file
+		inline size_t Compressor::readBlock(std::FILE* source, unsigned char* buffer, size_t& noRead, std::chrono::steady_clock::time_point start)
+		{
+			const size_t rate = m_Rate.load(std::memory_order_relaxed);
+			if (rate > 0u && !m_Stop.load(std::memory_order_relaxed))
+				std::this_thread::sleep_until(start + std::chrono::microseconds(static_cast<long long>(noRead / rate * 1000000u + noRead % rate * 1000000u / rate)));
+
+			const size_t size = std::fread(buffer, 1u, BLOCK_SIZE, source);
+			noRead += size;
+			return size;
+		}
+
+		// Compresses "source" to "output" using the LZ4 frame format, returns false if it could not be written
+		inline bool Compressor::compressLz4(std::FILE* source, std::FILE* output)
+		{
+			std::vector<unsigned char> block(BLOCK_SIZE), compressed(BLOCK_SIZE + BLOCK_SIZE / 255u + 16u);
+			const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			size_t noRead = 0u, size;
+
+			// Frame header: magic number, flags (version 1, independent blocks), maximum block size (64 KiB) and header checksum
+			unsigned char header[7];
+			writeLittleEndian(header, 0x184D2204u);
+			header[4] = 0x60u;
+			header[5] = 0x40u;
+			header[6] = static_cast<unsigned char>(xxHash32(header + 4, 2u) >> 8);
+			if (std::fwrite(header, 1u, sizeof(header), output) != sizeof(header))
+				return false;
+
+			while ((size = readBlock(source, block.data(), noRead, start)) > 0u)
+			{
+				// Blocks which cannot be compressed are stored as they are, with the highest bit of their size set
+				unsigned char blockSize[4];
+				size_t compressedSize = compressBlock(block.data(), size, compressed.data());
+				const unsigned char* data = compressed.data();
+				if (compressedSize >= size)
+				{
+					writeLittleEndian(blockSize, static_cast<std::uint32_t>(size) | 0x80000000u);
+					compressedSize = size;
+					data = block.data();
+				}
+				else
+					writeLittleEndian(blockSize, static_cast<std::uint32_t>(compressedSize));
+
+				if (std::fwrite(blockSize, 1u, sizeof(blockSize), output) != sizeof(blockSize) || std::fwrite(data, 1u, compressedSize, output) != compressedSize)
+					return false;
+			}
+
+			// End mark
+			unsigned char endMark[4] = {};
+			return !std::ferror(source) && std::fwrite(endMark, 1u, sizeof(endMark), output) == sizeof(endMark);
+		}
+
+		// Compresses "source" to "output" using the gzip format, returns false if it could not be written
+		inline bool Compressor::compressGzip(std::FILE* source, std::FILE* output)
+		{
+#ifdef SBLOGGER_ZLIB
+			std::vector<unsigned char> block(BLOCK_SIZE), compressed(BLOCK_SIZE);
+			const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			size_t noRead = 0u, size;
+			z_stream stream{};
+			bool written = true;
+
+			// A window of 15 bits, plus 16 for a gzip header
+			if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+				return false;
+
+			do
+			{
+				size = readBlock(source, block.data(), noRead, start);
+				stream.next_in = block.data();
+				stream.avail_in = static_cast<uInt>(size);
+				do
+				{
+					stream.next_out = compressed.data();
+					stream.avail_out = static_cast<uInt>(compressed.size());
+					deflate(&stream, size > 0u ? Z_NO_FLUSH : Z_FINISH);
+
+					const size_t compressedSize = compressed.size() - stream.avail_out;
+					if (std::fwrite(compressed.data(), 1u, compressedSize, output) != compressedSize)
+						written = false;
+				} while (stream.avail_out == 0u && written);
+			} while (size > 0u && written);
+
+			deflateEnd(&stream);
+			return written && !std::ferror(source);
+#else
+			return compressLz4(source, output);
+#endif
+		}
+
+		// Compresses the file of "job" to a temporary file, renamed to its output path if successful, returns the size of the output (0 if not compressed)
+		inline size_t Compressor::compress(const Job& job)
+		{
+			const std::string temporaryPath(job.outputPath + ".tmp");
+			std::FILE* output = std::fopen(temporaryPath.c_str(), "wb");
+			if (output == nullptr)
+				return 0u;
+
+			bool compressed = job.compression == Compression::GZIP ? compressGzip(job.source, output) : compressLz4(job.source, output);
+			const long size = std::ftell(output);
+			compressed = std::fclose(output) == 0 && compressed && size > 0;
+
+			if (!compressed || std::rename(temporaryPath.c_str(), job.outputPath.c_str()) != 0)
+			{
+				std::remove(temporaryPath.c_str());
+				return 0u;
+			}
+			return static_cast<size_t>(size);
+		}
+
+		// Compresses the files added, until the compressor is destroyed and all of them are compressed
+		inline void Compressor::run()
+		{
+#ifdef __linux__
+			// Lowest CPU priority and idle I/O priority (both being attributes of the calling thread on Linux)
+			(void)::setpriority(PRIO_PROCESS, 0, 19);
+#ifdef SYS_ioprio_set
+			(void)::syscall(SYS_ioprio_set, 1 /* IOPRIO_WHO_PROCESS */, 0, 3 << 13 /* IOPRIO_CLASS_IDLE */);
+#endif
+#endif
+			std::unique_lock<std::mutex> lock(m_Mutex);
+
+			while (!m_Stop || !m_Jobs.empty())
+			{
+				if (m_Jobs.empty())
+				{
+					m_WakeUp.wait(lock);
+					continue;
+				}
+
+				Job job(std::move(m_Jobs.front()));
+				m_Jobs.pop_front();
+				m_RunningOwner = job.owner;
+				lock.unlock();
+
+				const size_t size = compress(job);
+				try
+				{
+					if (job.done)
+						job.done(size > 0u, size);
+					else if (size > 0u)
+						std::remove(job.sourcePath.c_str());
+				}
+				catch (...)
+				{ }
+				// Closed last, so that the source is freed (if deleted) without holding the mutex of its logger
+				std::fclose(job.source);
+				job.done = nullptr;
+
+				lock.lock();
+				m_RunningOwner = nullptr;
+				m_JobDone.notify_all();
+			}
+		}
+
+		//
+		// Public methods
+		//
+
+		// Get the compressor shared by all the loggers, created the first time it is used (loggers using it should call this from their constructors,
+		// so that it is destroyed after them)
+		inline Compressor& Compressor::Get() noexcept
+		{
+			static Compressor compressor;
+			return compressor;
+		}
+
+		// Get the extension added to the files compressed using "compression" (ex.: ".gz")
+		inline const char* Compressor::GetExtension(Compression compression) noexcept
+		{
+			switch (compression)
+			{
+			case Compression::LZ4:	return ".lz4";
+			case Compression::GZIP:	return ".gz";
+			default:				return "";
+			}
+		}
+
+		// Adds a file to compress (its source is closed by the compressor)
+		inline void Compressor::Add(Job job)
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			std::FILE* source = job.source;
+
+			try
+			{
+				m_Jobs.push_back(std::move(job));
+			}
+			catch (...)
+			{
+				std::fclose(source);
+				throw;
+			}
+
+			if (!m_Thread.joinable())
+				m_Thread = std::thread(&Compressor::run, this);
+			m_WakeUp.notify_all();
+		}
+
+		// Removes the files added by "owner", waiting for the one being compressed (if any)
+		inline void Compressor::Cancel(const void* owner)
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+
+			for (auto job = m_Jobs.begin(); job != m_Jobs.end();)
+				if (job->owner == owner)
+				{
+					std::fclose(job->source);
+					job = m_Jobs.erase(job);
+				}
+				else
+					++job;
+
+			m_JobDone.wait(lock, [this, owner]() { return m_RunningOwner != owner; });
+		}
+
+		// Set the maximum number of bytes read per second (0 for no limit)
+		inline void Compressor::SetRate(size_t bytesPerSecond) noexcept
+		{
+			m_Rate.store(bytesPerSecond, std::memory_order_relaxed);
+		}
+
+		// Get the maximum number of bytes read per second
+		inline size_t Compressor::GetRate() const noexcept
+		{
+			return m_Rate.load(std::memory_order_relaxed);
+		}
+
+		// Types of the arguments copied into a deferred record
+		enum class RecordArgumentType : unsigned char
+		{
+			BOOL, CHAR, INT64, UINT64, DOUBLE, STRING
+		};
+
+		// Maximum number of arguments of a message which can be deferred
+		static const size_t MAX_RECORD_ARGUMENTS = 32u;
+
+		// Start of a deferred record: the message is either a string literal (kept as a pointer) or copied right after the header, followed by the arguments
+		struct RecordHeader
+		{
+			const char* message;
+			size_t messageSize;
+			const CallSite* callSite;
+			long long time;
+			long long elapsed;
+			LogLevel level;
+			bool newLine;
+			unsigned char noArguments;
+		};
+
+		// Text of a string argument decoded from a deferred record
+		struct StringReference
+		{
+			const char* data;
+			size_t size;
+		};
+
+		// Value of an argument decoded from a deferred record
+		struct RecordArgumentValue
+		{
+			bool boolean;
+			char character;
+			long long integer;
+			unsigned long long unsignedInteger;
+			double floatingPoint;
+			StringReference string;
+		};
+
+		// Append the type and the raw bytes of an argument to a record
+		void appendRecordValue(std::string& record, RecordArgumentType type, const void* value, size_t size);
+
+		// Append a string argument (its size followed by its characters) to a record
+		void appendRecordString(std::string& record, const char* data, size_t size);
+
+		// Converts a string argument decoded from a record to text, appending it to "output"
+		void formatStringReference(std::string& output, const void* value);
+
+		// Decodes the "noArguments" arguments of a record found at "data" into "values", referenced by "arguments", returns the number of bytes read
+		size_t decodeRecordArguments(const char* data, size_t noArguments, RecordArgumentValue* values, FormatArgument* arguments) noexcept;
+
+		// Copies an argument of type T into a deferred record ("ENCODABLE" is false for types which must be formatted by the calling thread)
+		template<typename T, typename = void>
+		struct RecordArgument
+		{
+			static const bool ENCODABLE = false;
+		};
+
+		// Booleans
+		template<>
+		struct RecordArgument<bool>
+		{
+			static const bool ENCODABLE = true;
+
+			// Append "value" to "record"
+			static void Encode(std::string& record, bool value)
+			{
+				appendRecordValue(record, RecordArgumentType::BOOL, &value, sizeof(value));
+			}
+		};
+
+		// Characters
+		template<typename T>
+		struct RecordArgument<T, typename std::enable_if<std::is_same<T, char>::value || std::is_same<T, signed char>::value || std::is_same<T, unsigned char>::value>::type>
+		{
+			static const bool ENCODABLE = true;
+
+			// Append "value" to "record"
+			static void Encode(std::string& record, T value)
+			{
+				char character = static_cast<char>(value);
+				appendRecordValue(record, RecordArgumentType::CHAR, &character, sizeof(character));
+			}
+		};
+
+		// Integers (copied as 64 bit values)
+		template<typename T>
+		struct RecordArgument<T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value && !std::is_same<T, char>::value
+			&& !std::is_same<T, signed char>::value && !std::is_same<T, unsigned char>::value && (sizeof(T) <= sizeof(long long))>::type>
+		{
+			static const bool ENCODABLE = true;
+
+			// Append "value" to "record"
+			static void Encode(std::string& record, T value)
+			{
+				if (std::is_signed<T>::value)
+				{
+					long long integer = static_cast<long long>(value);
+					appendRecordValue(record, RecordArgumentType::INT64, &integer, sizeof(integer));
+				}
+				else
+				{
+					unsigned long long integer = static_cast<unsigned long long>(value);
+					appendRecordValue(record, RecordArgumentType::UINT64, &integer, sizeof(integer));
+				}
+			}
+		};
+
+		// Floating point numbers (copied as double)
+		template<typename T>
+		struct RecordArgument<T, typename std::enable_if<std::is_floating_point<T>::value>::type>
+		{
+			static const bool ENCODABLE = true;
+
+			// Append "value" to "record"
+			static void Encode(std::string& record, T value)
+			{
+				double floatingPoint = static_cast<double>(value);
+				appendRecordValue(record, RecordArgumentType::DOUBLE, &floatingPoint, sizeof(floatingPoint));
+			}
+		};
+
+		// C strings (their characters are copied)
+		template<>
+		struct RecordArgument<const char*>
+		{
+			static const bool ENCODABLE = true;
+
+			// Append "value" to "record"
+			static void Encode(std::string& record, const char* value)
+			{
+				appendRecordString(record, value, value != nullptr ? std::strlen(value) : 0u);
+			}
+		};
+
+		// C strings (their characters are copied)
+		template<>
+		struct RecordArgument<char*> : RecordArgument<const char*>
+		{ };
+
+		// Get the call site added by the logging macros, if "value" is one
+		inline const CallSite* callSiteOf(const CallSite* value) noexcept
+		{
+			return value;
+		}
+
+		// Get the call site added by the logging macros, if "value" is one
+		template<typename T>
+		const CallSite* callSiteOf(const T&) noexcept
+		{
+			return nullptr;
+		}
+
+		// Call sites added by the logging macros (kept in the record header instead)
+		template<>
+		struct RecordArgument<const CallSite*>
+		{
+			static const bool ENCODABLE = true;
+
+			// Nothing to append, the call site being static
+			static void Encode(std::string&, const CallSite*)
+			{ }
+		};
+
+		// Character arrays, up to the null terminator (their characters are copied)
+		template<size_t N>
+		struct RecordArgument<char[N]>
+		{
+			static const bool ENCODABLE = true;
+
+			// Append "value" to "record"
+			static void Encode(std::string& record, const char (&value)[N])
+			{
+				size_t size = 0u;
+				while (size < N && value[size] != '\0')
+					++size;
+				appendRecordString(record, value, size);
+			}
+		};
+
+		// Strings (their characters are copied)
+		template<>
+		struct RecordArgument<std::string>
+		{
+			static const bool ENCODABLE = true;
+
+			// Append "value" to "record"
+			static void Encode(std::string& record, const std::string& value)
+			{
+				appendRecordString(record, value.data(), value.size());
+			}
+		};
+#ifndef SBLOGGER_LEGACY
+
+		// String views (their characters are copied)
+		template<>
+		struct RecordArgument<std::string_view>
+		{
+			static const bool ENCODABLE = true;
+
+			// Append "value" to "record"
+			static void Encode(std::string& record, std::string_view value)
+			{
+				appendRecordString(record, value.data(), value.size());
+			}
+		};
+#endif
+
+		// Check if all of the types can be copied into a deferred record
+		template<typename ...T>
+		struct RecordArguments;
+
+		// Check if all of the types can be copied into a deferred record (no types)
+		template<>
+		struct RecordArguments<>
+		{
+			static const bool ENCODABLE = true;
+		};
+
+		// Check if all of the types can be copied into a deferred record
+		template<typename T, typename ...TRest>
+		struct RecordArguments<T, TRest...>
+		{
+			static const bool ENCODABLE = RecordArgument<T>::ENCODABLE && RecordArguments<TRest...>::ENCODABLE;
+		};
+
+		// Append the type and the raw bytes of an argument to a record
+		inline void appendRecordValue(std::string& record, RecordArgumentType type, const void* value, size_t size)
+		{
+			record.push_back(static_cast<char>(type));
+			record.append(static_cast<const char*>(value), size);
+		}
+
+		// Append a string argument (its size followed by its characters) to a record
+		inline void appendRecordString(std::string& record, const char* data, size_t size)
+		{
+			appendRecordValue(record, RecordArgumentType::STRING, &size, sizeof(size));
+			record.append(data, size);
+		}
+
+		// Converts a string argument decoded from a record to text, appending it to "output"
+		inline void formatStringReference(std::string& output, const void* value)
+		{
+			const StringReference* string = static_cast<const StringReference*>(value);
+			output.append(string->data, string->size);
+		}
+
+		// Decodes the "noArguments" arguments of a record found at "data" into "values", referenced by "arguments", returns the number of bytes read
+		inline size_t decodeRecordArguments(const char* data, size_t noArguments, RecordArgumentValue* values, FormatArgument* arguments) noexcept
+		{
+			size_t position = 0u;
+
+			for (size_t i = 0u; i < noArguments; ++i)
+			{
+				RecordArgumentValue& value = values[i];
+				switch (static_cast<RecordArgumentType>(data[position++]))
+				{
+				case RecordArgumentType::BOOL:
+					std::memcpy(&value.boolean, data + position, sizeof(value.boolean));
+					position += sizeof(value.boolean);
+					arguments[i] = { &value.boolean, &formatArgument<bool> };
+					break;
+				case RecordArgumentType::CHAR:
+					value.character = data[position++];
+					arguments[i] = { &value.character, &formatArgument<char> };
+					break;
+				case RecordArgumentType::INT64:
+					std::memcpy(&value.integer, data + position, sizeof(value.integer));
+					position += sizeof(value.integer);
+					arguments[i] = { &value.integer, &formatArgument<long long> };
+					break;
+				case RecordArgumentType::UINT64:
+					std::memcpy(&value.unsignedInteger, data + position, sizeof(value.unsignedInteger));
+					position += sizeof(value.unsignedInteger);
+					arguments[i] = { &value.unsignedInteger, &formatArgument<unsigned long long> };
+					break;
+				case RecordArgumentType::DOUBLE:
+					std::memcpy(&value.floatingPoint, data + position, sizeof(value.floatingPoint));
+					position += sizeof(value.floatingPoint);
+					arguments[i] = { &value.floatingPoint, &formatArgument<double> };
+					break;
+				case RecordArgumentType::STRING:
+					std::memcpy(&value.string.size, data + position, sizeof(value.string.size));
+					value.string.data = data + position + sizeof(value.string.size);
+					position += sizeof(value.string.size) + value.string.size;
+					arguments[i] = { &value.string, &formatStringReference };
+					break;
+				}
+			}
+
+			return position;
+		}
+
+		// Kinds of the entries of a binary log file, other than records (which start with the identifier of their message, never 0, instead of 0 and their kind)
+		enum class BinaryEntryType : unsigned char
+		{
+			SESSION = 'S', MESSAGE = 'M', TEXT = 'T'
+		};
+
+		// Version of the binary log format, written at the start of every session
+		static const unsigned char BINARY_LOG_VERSION = 1u;
+
+		// Flags of the messages written to the dictionary of a binary log file
+		static const unsigned char BINARY_NEW_LINE = 1u, BINARY_HAS_TEXT = 2u, BINARY_HAS_CALL_SITE = 4u;
+
+		// Append "value" to "output" using 7 bits per byte, from the lowest ones (the highest bit being set on all the bytes but the last)
+		inline void appendVarint(std::string& output, unsigned long long value)
+		{
+			while (value >= 0x80u)
+			{
+				output.push_back(static_cast<char>((value & 0x7Fu) | 0x80u));
+				value >>= 7u;
+			}
+			output.push_back(static_cast<char>(value));
+		}
+
+		// Append a signed "value" to "output" as a varint, interleaving positive and negative values (0, -1, 1, -2...) so that small ones stay short
+		inline void appendSignedVarint(std::string& output, long long value)
+		{
+			const unsigned long long bits = static_cast<unsigned long long>(value);
+			appendVarint(output, (bits << 1u) ^ (0u - (bits >> 63u)));
+		}
+
+		// Append a string (its size followed by its characters) to a binary log
+		inline void appendBinaryString(std::string& output, const char* data, size_t size)
+		{
+			appendVarint(output, size);
+			output.append(data, size);
+		}
+
+		// Encoder of the messages written by a FileLogger in binary mode: a record only holds the identifier of its message, the time elapsed since
+		// the previous one and its arguments (integers and sizes as varints), while the message itself, its level and its call site are written
+		// to the dictionary the first time they are used in a session (each file starting a new one, so that it can be read on its own)
+		class BinaryEncoder
+		{
+			//
+			// Private members
+			//
+
+			// Static parts of a message, identified in the file by a single number
+			struct MessageKey
+			{
+				const CallSite* callSite;
+				const char* message;	// Only set for string literals, other messages being copied into each of their records
+				size_t indent;
+				LogLevel level;
+				bool newLine;
+				unsigned char noArguments;
+
+				bool operator==(const MessageKey& other) const noexcept
+				{
+					return callSite == other.callSite && message == other.message && indent == other.indent && level == other.level
+						&& newLine == other.newLine && noArguments == other.noArguments;
+				}
+			};
+
+			// Hash of the static parts of a message
+			struct MessageKeyHash
+			{
+				size_t operator()(const MessageKey& key) const noexcept
+				{
+					const std::hash<const void*> hash;
+					return hash(key.callSite) ^ (hash(key.message) * 31u) ^ (key.indent << 16u) ^ (static_cast<size_t>(key.level) << 9u)
+						^ (key.newLine ? 0x100u : 0u) ^ key.noArguments;
+				}
+			};
+
+			std::unordered_map<MessageKey, size_t, MessageKeyHash> m_Ids;
+			long long m_Time;
+			bool m_Started;
+
+			//
+			// Private methods
+			//
+
+			// Appends the start of a session to "output" (if not started yet), holding the "format" used to read its messages and the time of its first entry
+			void start(std::string& output, const std::string& format, long long time);
+
+			// Appends "time" as the difference from the time of the previous entry
+			void appendTime(std::string& output, long long time);
+
+			// Appends the "noArguments" arguments of a deferred record found at "data" to "output" (integers and string sizes as varints)
+			static void appendArguments(std::string& output, const char* data, size_t noArguments);
+
+		public:
+			//
+			// Constructors and destructors
+			//
+
+			// Creates an encoder whose session starts with the first entry
+			BinaryEncoder();
+
+			//
+			// Public methods
+			//
+
+			// Starts a new session with the next entry (e.g. in a new file), writing the messages to the dictionary again
+			void Reset() noexcept;
+
+			// Appends a deferred record (as created by Logger::deferMessage) written at "time" to "output", preceded by the dictionary entry of its message if new
+			void AppendRecord(std::string& output, const std::string& format, const std::string& record, std::chrono::system_clock::time_point time, size_t indent);
+
+			// Appends a message of "logLevel" written at "time", already formatted as "text", to "output"
+			void AppendText(std::string& output, const std::string& format, LogLevel logLevel, const std::string& text, std::chrono::system_clock::time_point time);
+		};
+
+		//
+		// Constructors and destructors
+		//
+
+		// Creates an encoder whose session starts with the first entry
+		inline BinaryEncoder::BinaryEncoder()
+			: m_Ids(), m_Time(0), m_Started(false)
+		{ }
+
+		//
+		// Private methods
+		//
+
+		// Appends the start of a session to "output" (if not started yet), holding the "format" used to read its messages and the time of its first entry
+		inline void BinaryEncoder::start(std::string& output, const std::string& format, long long time)
+		{
+			if (m_Started)
+				return;
+
+			// Floating point arguments are written as they are in memory, so the reader checks they were written with the same byte order
+			const unsigned short byteOrder = 0x0102u;
+			const long long elapsedOrigin = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count()
+				- Clock::Elapsed().count();
+
+			appendVarint(output, 0u);
+			output.push_back(static_cast<char>(BinaryEntryType::SESSION));
+			output.append("BLOG", 4u);
+			output.push_back(static_cast<char>(BINARY_LOG_VERSION));
+			output.append(reinterpret_cast<const char*>(&byteOrder), sizeof(byteOrder));
+			appendSignedVarint(output, time);
+			appendSignedVarint(output, elapsedOrigin);
+			appendBinaryString(output, format.data(), format.size());
+
+			m_Ids.clear();
+			m_Time = time;
+			m_Started = true;
+		}
+
+		// Appends "time" as the difference from the time of the previous entry
+		inline void BinaryEncoder::appendTime(std::string& output, long long time)
+		{
+			appendSignedVarint(output, static_cast<long long>(static_cast<unsigned long long>(time) - static_cast<unsigned long long>(m_Time)));
+			m_Time = time;
+		}
+
+		// Appends the "noArguments" arguments of a deferred record found at "data" to "output" (integers and string sizes as varints)
+		inline void BinaryEncoder::appendArguments(std::string& output, const char* data, size_t noArguments)
+		{
+			long long integer;
+			unsigned long long unsignedInteger;
+			size_t position = 0u, size;
+
+			for (size_t i = 0u; i < noArguments; ++i)
+			{
+				const char type = data[position++];
+
+				output.push_back(type);
+				switch (static_cast<RecordArgumentType>(type))
+				{
+				case RecordArgumentType::BOOL:
+					output.push_back(data[position] != 0 ? 1 : 0);
+					position += sizeof(bool);
+					break;
+				case RecordArgumentType::CHAR:
+					output.push_back(data[position++]);
+					break;
+				case RecordArgumentType::INT64:
+					std::memcpy(&integer, data + position, sizeof(integer));
+					position += sizeof(integer);
+					appendSignedVarint(output, integer);
+					break;
+				case RecordArgumentType::UINT64:
+					std::memcpy(&unsignedInteger, data + position, sizeof(unsignedInteger));
+					position += sizeof(unsignedInteger);
+					appendVarint(output, unsignedInteger);
+					break;
+				case RecordArgumentType::DOUBLE:
+					output.append(data + position, sizeof(double));
+					position += sizeof(double);
+					break;
+				case RecordArgumentType::STRING:
+					std::memcpy(&size, data + position, sizeof(size));
+					position += sizeof(size);
+					appendBinaryString(output, data + position, size);
+					position += size;
+					break;
+				}
+			}
+		}
+
+		//
+		// Public methods
+		//
+
+		// Starts a new session with the next entry (e.g. in a new file), writing the messages to the dictionary again
+		inline void BinaryEncoder::Reset() noexcept
+		{
+			m_Started = false;
+		}
+
+		// Appends a deferred record (as created by Logger::deferMessage) written at "time" to "output", preceded by the dictionary entry of its message if new
+		inline void BinaryEncoder::AppendRecord(std::string& output, const std::string& format, const std::string& record, std::chrono::system_clock::time_point time,
+			size_t indent)
+		{
+			const long long nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+			RecordHeader header;
+			size_t position = sizeof(header);
+
+			std::memcpy(&header, record.data(), sizeof(header));
+			start(output, format, nanoseconds);
+
+			const MessageKey key{ header.callSite, header.message, indent, header.level, header.newLine, header.noArguments };
+			auto id = m_Ids.find(key);
+			if (id == m_Ids.end())
+			{
+				id = m_Ids.emplace(key, m_Ids.size() + 1u).first;
+
+				appendVarint(output, 0u);
+				output.push_back(static_cast<char>(BinaryEntryType::MESSAGE));
+				appendVarint(output, id->second);
+				output.push_back(static_cast<char>(header.level));
+				output.push_back(static_cast<char>((header.newLine ? BINARY_NEW_LINE : 0u) | (header.message != nullptr ? BINARY_HAS_TEXT : 0u)
+					| (header.callSite != nullptr ? BINARY_HAS_CALL_SITE : 0u)));
+				output.push_back(static_cast<char>(header.noArguments));
+				appendVarint(output, indent);
+				if (header.message != nullptr)
+					appendBinaryString(output, header.message, header.messageSize);
+				if (header.callSite != nullptr)
+				{
+					appendVarint(output, header.callSite->line);
+					appendBinaryString(output, header.callSite->file, std::strlen(header.callSite->file));
+					appendBinaryString(output, header.callSite->fileName, std::strlen(header.callSite->fileName));
+					appendBinaryString(output, header.callSite->function, std::strlen(header.callSite->function));
+				}
+			}
+
+			appendVarint(output, id->second);
+			appendTime(output, nanoseconds);
+			if (header.message == nullptr)
+			{
+				appendBinaryString(output, record.data() + position, header.messageSize);
+				position += header.messageSize;
+			}
+			appendArguments(output, record.data() + position, header.noArguments);
+		}
+
+		// Appends a message of "logLevel" written at "time", already formatted as "text", to "output"
+		inline void BinaryEncoder::AppendText(std::string& output, const std::string& format, LogLevel logLevel, const std::string& text,
+			std::chrono::system_clock::time_point time)
+		{
+			const long long nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+
+			start(output, format, nanoseconds);
+			appendVarint(output, 0u);
+			output.push_back(static_cast<char>(BinaryEntryType::TEXT));
+			output.push_back(static_cast<char>(logLevel));
+			appendTime(output, nanoseconds);
+			appendBinaryString(output, text.data(), text.size());
+		}
+	}
+
+#ifndef SBLOGGER_LEGACY
+	//
+	// FormatString class
+	//
+
+	// Message format whose placeholders are checked (C++20) and split into segments at compile time
+	// (For C++17 compilers the segments are computed when the format string is created, unless it is a constant expression)
+	template<typename ...T>
+	class FormatString
+	{
+		//
+		// Private members
+		//
+
+		const char* m_Data;
+		size_t m_Size;
+		detail::FormatSegment m_Segments[SBLOGGER_MAX_FORMAT_SEGMENTS];
+		size_t m_NoSegments;
+		bool m_Precomputed;
+		bool m_Static;
+
+		//
+		// Private methods
+		//
+
+		// Append a literal segment (of "size" characters), followed by an argument
+		constexpr void addSegment(size_t offset, size_t size, size_t argument) noexcept;
+
+		// Split "format" (of at most "capacity" characters) into literal segments and placeholders
+		constexpr void parse(const char* format, size_t capacity) noexcept;
+
+	public:
+		//
+		// Constructors and destructors
+		//
+
+		// Creates a format string from a string literal, splitting it into literal segments and placeholders
+		template<size_t N>
+#ifdef SBLOGGER_CONSTEVAL_FORMATS
+		consteval FormatString(const char (&format)[N]) noexcept;
+#else
+		constexpr FormatString(const char (&format)[N]) noexcept;
+#endif
+#ifdef SBLOGGER_CONSTEVAL_FORMATS
+
+		// Creates a format string from a character buffer (e.g. filled by snprintf), split into segments when written, as its content is only known at runtime
+		template<size_t N>
+		constexpr FormatString(char (&format)[N]) noexcept;
+#endif
+
+		//
+		// Public methods
+		//
+
+		// Get the format text
+		constexpr const char* Data() const noexcept;
+
+		// Get the length of the format text
+		constexpr size_t Size() const noexcept;
+
+		// Get a view of the format, pointing to the precomputed segments (if the format was not too long to precompute)
+		detail::MessageView View() const noexcept;
+	};
+
+	//
+	// Constructors and destructors
+	//
+
+	// Creates a format string from a string literal, splitting it into literal segments and placeholders
+	template<typename ...T>
+	template<size_t N>
+#ifdef SBLOGGER_CONSTEVAL_FORMATS
+	inline consteval FormatString<T...>::FormatString(const char (&format)[N]) noexcept
+#else
+	inline constexpr FormatString<T...>::FormatString(const char (&format)[N]) noexcept
+#endif
+		: m_Data(format), m_Size(0u), m_Segments{}, m_NoSegments(0u), m_Precomputed(true), m_Static(true)
+	{
+		parse(format, N);
+	}
+#ifdef SBLOGGER_CONSTEVAL_FORMATS
+
+	// Creates a format string from a character buffer (e.g. filled by snprintf), split into segments when written, as its content is only known at runtime
+	template<typename ...T>
+	template<size_t N>
+	inline constexpr FormatString<T...>::FormatString(char (&format)[N]) noexcept
+		: m_Data(format), m_Size(0u), m_Segments{}, m_NoSegments(0u), m_Precomputed(true), m_Static(false)
+	{
+		parse(format, N);
+	}
+#endif
+
+	//
+	// Private methods
+	//
+
+	// Append a literal segment (of "size" characters), followed by an argument
+	template<typename ...T>
+	inline constexpr void FormatString<T...>::addSegment(size_t offset, size_t size, size_t argument) noexcept
+	{
+		if (m_NoSegments == SBLOGGER_MAX_FORMAT_SEGMENTS || offset + size >= detail::FormatSegment::NO_ARGUMENT)
+			m_Precomputed = false;
+		else
+			m_Segments[m_NoSegments++] = { static_cast<unsigned short>(offset), static_cast<unsigned short>(size), static_cast<unsigned short>(argument) };
+	}
+
+	// Split "format" (of at most "capacity" characters) into literal segments and placeholders
+	template<typename ...T>
+	inline constexpr void FormatString<T...>::parse(const char* format, size_t capacity) noexcept
+	{
+		// The call site added by the logging macros (if any) is not one of the arguments of the format
+		const size_t noArguments = sizeof...(T) - (detail::HasCallSite<T...>::value ? 1u : 0u);
+		size_t literalStart = 0u, position = 0u, argument = 0u;
+
+		while (m_Size < capacity && format[m_Size] != '\0')
+			++m_Size;
+
+		for (size_t current = 0u; current < m_Size; ++current)
+			if (format[current] == '{')
+			{
+				if (current + 1u < m_Size && format[current + 1u] == '{')
+				{
+					addSegment(literalStart, ++current - literalStart, detail::FormatSegment::NO_ARGUMENT);
+					literalStart = current + 1u;
+					continue;
+				}
+
+				for (position = current + 1u, argument = 0u; position < m_Size && position - current <= 9u && format[position] >= '0' && format[position] <= '9'; ++position)
+					argument = argument * 10u + static_cast<size_t>(format[position] - '0');
+				if (position > current + 1u && position < m_Size && format[position] == '}')
+				{
+					if (argument < noArguments)
+					{
+						addSegment(literalStart, current - literalStart, argument);
+						literalStart = (current = position) + 1u;
+					}
+#ifdef SBLOGGER_CONSTEVAL_FORMATS
+					else
+						detail::formatPlaceholderWithoutArgument();
+#endif
+				}
+			}
+			else if (format[current] == '}' && current + 1u < m_Size && format[current + 1u] == '}')
+			{
+				addSegment(literalStart, ++current - literalStart, detail::FormatSegment::NO_ARGUMENT);
+				literalStart = current + 1u;
+			}
+
+		if (literalStart < m_Size)
+			addSegment(literalStart, m_Size - literalStart, detail::FormatSegment::NO_ARGUMENT);
+	}
+
+	//
+	// Public methods
+	//
+
+	// Get the format text
+	template<typename ...T>
+	inline constexpr const char* FormatString<T...>::Data() const noexcept
+	{
+		return m_Data;
+	}
+
+	// Get the length of the format text
+	template<typename ...T>
+	inline constexpr size_t FormatString<T...>::Size() const noexcept
+	{
+		return m_Size;
+	}
+
+	// Get a view of the format, pointing to the precomputed segments (if the format was not too long to precompute)
+	template<typename ...T>
+	inline detail::MessageView FormatString<T...>::View() const noexcept
+	{
+#ifdef SBLOGGER_CONSTEVAL_FORMATS
+		return { m_Data, m_Size, m_Precomputed ? m_Segments : nullptr, m_NoSegments, nullptr, 0u, m_Static };
+#else
+		return { m_Data, m_Size, m_Precomputed ? m_Segments : nullptr, m_NoSegments, nullptr, 0u, false };
+#endif
+	}
+#endif
+
+	//
+	// Classes' definitions
+	//
+
+	// Registry of the call sites of the logging macros, whose messages can be enabled or disabled at runtime (similar to the dynamic debug of the Linux kernel)
+	// Call sites are registered the first time they are reached, the changes made before that applying to them as well
+	class CallSiteRegistry
+	{
+	private:
+		//
+		// Private members
+		//
+
+		// Kinds of call sites a change applies to
+		enum class RuleType
+		{
+			FILE_PATTERN, FUNCTION, LEVEL
+		};
+
+		// Change of the state of the call sites of a file pattern, function or level
+		struct Rule
+		{
+			RuleType type;
+			std::string pattern;
+			LogLevel level;
+			CallSiteState state;
+		};
+
+		// Registered call sites and the changes applied to them, in order
+		struct Registry
+		{
+			std::mutex mutex;
+			std::vector<const CallSite*> callSites;
+			std::vector<Rule> rules;
+		};
+
+		//
+		// Private methods
+		//
+
+		// Get the registry shared by all call sites
+		static Registry& registry();
+
+		// Check if "rule" applies to "callSite"
+		static bool matches(const Rule& rule, const CallSite& callSite) noexcept;
+
+		// Registers "callSite", returning its state after applying the changes made so far
+		static CallSiteState registerCallSite(const CallSite& callSite);
+
+		// Applies "rule" to the registered call sites and keeps it for the ones registered later, returns the number of call sites changed
+		static size_t applyRule(const Rule& rule);
+
+	public:
+		//
+		// Public methods
+		//
+
+		// Get the state of "callSite", registering it the first time it is reached
+		static CallSiteState GetState(const CallSite& callSite);
+
+		// Set the state of the call sites in the files matching "filePattern" (matched against both the path and the name of the file, '*' matching
+		// any characters and '?' a single one), returns the number of registered call sites changed
+		static size_t SetFileState(const std::string& filePattern, CallSiteState state);
+
+		// Set the state of the call sites in "function" (its name, as given by __func__), returns the number of registered call sites changed
+		static size_t SetFunctionState(const std::string& function, CallSiteState state);
+
+		// Set the state of the call sites of "level" (TRACE for SBLOGGER_WRITE and SBLOGGER_WRITELINE), returns the number of registered call sites changed
+		static size_t SetLevelState(LogLevel level, CallSiteState state);
+
+		// Set all call sites back to the DEFAULT state, discarding the changes made so far
+		static void Reset();
+
+		// Get the call sites registered so far
+		static std::vector<const CallSite*> GetCallSites();
+	};
+
+	//
+	// Private methods
+	//
+
+	// Get the registry shared by all call sites
+	inline CallSiteRegistry::Registry& CallSiteRegistry::registry()
+	{
+		static Registry registry;
+		return registry;
+	}
+
+	// Check if "rule" applies to "callSite"
+	inline bool CallSiteRegistry::matches(const Rule& rule, const CallSite& callSite) noexcept
+	{
+		switch (rule.type)
+		{
+		case RuleType::FILE_PATTERN:
+			return detail::matchesPattern(rule.pattern.c_str(), callSite.file) || detail::matchesPattern(rule.pattern.c_str(), callSite.fileName);
+		case RuleType::FUNCTION:
+			return rule.pattern == callSite.function;
+		default:
+			return rule.level == callSite.level;
+		}
+	}
+
+	// Registers "callSite", returning its state after applying the changes made so far
+	inline CallSiteState CallSiteRegistry::registerCallSite(const CallSite& callSite)
+	{
+		Registry& registry = CallSiteRegistry::registry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+
+		// Another thread may have registered it first
+		CallSiteState state = callSite.state.load(std::memory_order_relaxed);
+		if (state != CallSiteState::UNREGISTERED)
+			return state;
+
+		state = CallSiteState::DEFAULT;
+		for (const Rule& rule : registry.rules)
+			if (matches(rule, callSite))
+				state = rule.state;
+
+		registry.callSites.push_back(&callSite);
+		callSite.state.store(state, std::memory_order_relaxed);
+		return state;
+	}
+
+	// Applies "rule" to the registered call sites and keeps it for the ones registered later, returns the number of call sites changed
+	inline size_t CallSiteRegistry::applyRule(const Rule& rule)
+	{
+		Registry& registry = CallSiteRegistry::registry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		size_t noChanged = 0u;
+
+		// A later change of the same call sites replaces the previous one
+		registry.rules.erase(std::remove_if(registry.rules.begin(), registry.rules.end(), [&rule](const Rule& other)
+			{
+				return other.type == rule.type && other.pattern == rule.pattern && other.level == rule.level;
+			}), registry.rules.end());
+		registry.rules.push_back(rule);
+
+		for (const CallSite* callSite : registry.callSites)
+			if (matches(rule, *callSite))
+			{
+				callSite->state.store(rule.state, std::memory_order_relaxed);
+				++noChanged;
+			}
+
+		return noChanged;
+	}
+
+	//
+	// Public methods
+	//
+
+	// Get the state of "callSite", registering it the first time it is reached
+	inline CallSiteState CallSiteRegistry::GetState(const CallSite& callSite)
+	{
+		const CallSiteState state = callSite.state.load(std::memory_order_relaxed);
+		return SBLOGGER_UNLIKELY(state == CallSiteState::UNREGISTERED) ? registerCallSite(callSite) : state;
+	}
+
+	// Set the state of the call sites in the files matching "filePattern" (matched against both the path and the name of the file, '*' matching
+	// any characters and '?' a single one), returns the number of registered call sites changed
+	inline size_t CallSiteRegistry::SetFileState(const std::string& filePattern, CallSiteState state)
+	{
+		return applyRule({ RuleType::FILE_PATTERN, filePattern, LogLevel::OFF, state });
+	}
+
+	// Set the state of the call sites in "function" (its name, as given by __func__), returns the number of registered call sites changed
+	inline size_t CallSiteRegistry::SetFunctionState(const std::string& function, CallSiteState state)
+	{
+		return applyRule({ RuleType::FUNCTION, function, LogLevel::OFF, state });
+	}
+
+	// Set the state of the call sites of "level" (TRACE for SBLOGGER_WRITE and SBLOGGER_WRITELINE), returns the number of registered call sites changed
+	inline size_t CallSiteRegistry::SetLevelState(LogLevel level, CallSiteState state)
+	{
+		return applyRule({ RuleType::LEVEL, std::string(), level, state });
+	}
+
+	// Set all call sites back to the DEFAULT state, discarding the changes made so far
+	inline void CallSiteRegistry::Reset()
+	{
+		Registry& registry = CallSiteRegistry::registry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+
+		registry.rules.clear();
+		for (const CallSite* callSite : registry.callSites)
+			callSite->state.store(CallSiteState::DEFAULT, std::memory_order_relaxed);
+	}
+
+	// Get the call sites registered so far
+	inline std::vector<const CallSite*> CallSiteRegistry::GetCallSites()
+	{
+		Registry& registry = CallSiteRegistry::registry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+
+		return registry.callSites;
+	}
+
+	// Abstract class which implements basic logger methods and members (ex.: auto flush, format, replace formatters etc)
+	class Logger
+	{
+	protected:
+		//
+		// Protected members
+		//
+
+		std::string m_Format;
+		detail::FormatProgram m_FormatProgram;
+		bool m_AutoFlush;
+		size_t m_IndentCount;
+		ClockType m_Clock;
+		std::atomic<bool> m_DeferFormatting;
+		std::atomic<LogLevel> m_LogLevel;
+
+		// Value of "m_LogLevel" for loggers using the global logging level
+		static const LogLevel GLOBAL_LOG_LEVEL = static_cast<LogLevel>(-1);
+
+		//
+		// Protected constructors
+		//
+
+		// Initialize a logger, with a format, auto flush (by default)
+		Logger(const std::string& format, bool autoFlush);
+
+		// Initialize a logger, with no format, auto flush (by default)
+		Logger(bool autoFlush) noexcept;
+
+		// Copy constructor
+		Logger(const Logger& other) noexcept;
+
+		//
+		// Protected methods
+		//
+
+		// Writes string to appropriate stream
+		virtual void writeToStream(const std::string& message) = 0;
+
+		// Hands a formatted message of "logLevel", written at "time" (if the format needs it), to the stream (by default, writing it right away using "writeToStream")
+		virtual void dispatchMessage(LogLevel logLevel, const std::string& message, std::chrono::system_clock::time_point time);
+
+		// Hands a deferred record (a message whose arguments are not yet formatted) of "logLevel", written at "time" (if the format needs it), to the stream (by default, formatting and writing it right away)
+		virtual void dispatchRecord(LogLevel logLevel, const std::string& record, std::chrono::system_clock::time_point time);
+
+		// Get the time of a message, if the format needs it
+		std::chrono::system_clock::time_point messageTime() const noexcept;
+
+		// Get the (monotonic) time elapsed since the first logger was created, if the format needs it (taken along with the time of a message)
+		std::chrono::nanoseconds messageElapsed() const noexcept;
+
+		// Check if the stream encodes deferred records itself, so that they should be handed to it unformatted (e.g. a FileLogger in binary mode)
+		virtual bool encodesRecords() const noexcept;
+
+		// Appends the ANSII colour code (e.g. 31 for red) if current stream supports them
+		// (The Logger base class does not do anything with the output, the method needing implementation from derived classes)
+		virtual void appendColour(std::string& output, size_t code, bool bright) const noexcept;
+
+		// Renders a compiled format into "output" in a single pass, writing "message" in place of "%msg", dates for the given time, the time "elapsed" since the first
+		// logger was created and the source info of "callSite" (if any)
+		void renderFormat(std::string& output, const detail::FormatProgram& program, LogLevel logLevel, const detail::MessageView& message,
+			const CallSite* callSite, std::chrono::system_clock::time_point time, std::chrono::nanoseconds elapsed) const;
+
+		// Append format (if it exists) and replace all "{n}" placeholders with their respective values (n=0,...)
+		void replacePlaceholders(std::string& output, LogLevel logLevel, detail::MessageView message, const detail::FormatArgument* arguments, size_t noArguments,
+			const CallSite* callSite, std::chrono::system_clock::time_point time, std::chrono::nanoseconds elapsed) const;
+
+		// Formats a message and its arguments and writes the result to the stream (if "logLevel" is enabled)
+		template<typename ...T>
+		void writeMessage(LogLevel logLevel, const detail::MessageView& message, bool newLine, const T& ...t);
+
+		// Copies a message and its arguments into a deferred record and hands it to the stream
+		template<typename ...T>
+		void deferMessage(std::true_type, LogLevel logLevel, const detail::MessageView& message, bool newLine, const T& ...t);
+
+		// Used for arguments which cannot be copied into a deferred record (never called)
+		template<typename ...T>
+		void deferMessage(std::false_type, LogLevel logLevel, const detail::MessageView& message, bool newLine, const T& ...t);
+
+		// Formats a deferred record (as created by "deferMessage"), appending the message to "output"
+		void formatRecord(std::string& output, const std::string& record) const;
+
+		// Hands a message of "logLevel" to the stream of "logger" (used by loggers which forward their output to another one, e.g. AsyncLogger)
+		static void dispatchMessageOf(Logger& logger, LogLevel logLevel, const std::string& message,
+			std::chrono::system_clock::time_point time = std::chrono::system_clock::time_point());
+
+		// Hands a deferred record of "logLevel" to the stream of "logger" (used by loggers which forward their output to another one, e.g. AsyncLogger)
+		static void dispatchRecordOf(Logger& logger, LogLevel logLevel, const std::string& record, std::chrono::system_clock::time_point time);
+
+		// Check if the stream of "logger" encodes deferred records itself (used by loggers which forward their output to another one, e.g. AsyncLogger)
+		static bool encodesRecordsOf(const Logger& logger) noexcept;
+
+		// Appends the ANSII colour code using the colours supported by "logger" (used by loggers which forward their output to another one, e.g. AsyncLogger)
+		static void appendColourOf(const Logger& logger, std::string& output, size_t code, bool bright) noexcept;
+
+		// Get the logging level shared by all loggers (initially the one given by "SBLOGGER_LOG_LEVEL", TRACE by default)
+		static std::atomic<LogLevel>& globalLogLevel() noexcept;
+
+		// Check if messages of "logLevel" written from "callSite" (if any) are written, the state of the call site taking precedence over the level
+		bool isEnabled(LogLevel logLevel, const CallSite* callSite) const;
+
+	public:
+		// Default destructor
+		virtual ~Logger() = default;
+
+		//
+		// Public methods
+		//
+
+		// Set the current logging level to one of the "LogLevel" options (ex.: TRACE, DEBUG, INFO etc).
+		static void SetLoggingLevel(const LogLevel& level) noexcept;
+
+		// Get the current logging level (one of the "LogLevel" options, ex.: TRACE, DEBUG, INFO etc).
+		static LogLevel GetLoggingLevel() noexcept;
+
+		// Set the logging level of this logger only, used instead of the global one (e.g. DEBUG for a single logger)
+		void SetLogLevel(LogLevel level) noexcept;
+
+		// Get the logging level used by this logger (its own, if set, otherwise the global one)
+		LogLevel GetLogLevel() const noexcept;
+
+		// Make this logger use the global logging level again
+		void ResetLogLevel() noexcept;
+
+		// Check if messages of "logLevel" are written, using the logging level of this logger if set, otherwise the global one
+		// (e.g. to skip building the arguments of a message which would not be written)
+		bool IsEnabled(LogLevel logLevel) const noexcept;
+
+		// Check if messages of "callSite" are written, based on its state (see CallSiteRegistry) and, by default, its level
+		bool IsEnabled(const CallSite& callSite) const;
+
+		// Get the current log format
+		inline std::string GetFormat() const noexcept;
+
+		// Set the current log format to "format"
+		inline void SetFormat(const std::string& format);
+
+		// Get the clock used to timestamp messages
+		ClockType GetClock() const noexcept;
+
+		// Set the clock used to timestamp messages (e.g. ClockType::TSC, which is calibrated against the system clock by this call)
+		void SetClock(ClockType clock) noexcept;
+
+		// Flush appropriate stream
+		virtual void Flush() noexcept = 0;
+
+		// Indent (prepend '\t') log, returns the number of indents the final message will contain
+		virtual size_t Indent() noexcept;
+
+		// Dedent (remove '\t') log, returns the number of indents the final message will contain
+		virtual size_t Dedent() noexcept;
+
+		//
+		// Generic Methods: Write a TRACE level message (depending on the specified "LOG_LEVEL") to a stream
+		//
+
+		// Writes to the stream the newline character, assuming a default log level of TRACE
+		void WriteLine(LogLevel logLevel = LogLevel::TRACE);
+
+		// Writes to the stream a message and inserts values into placeholders (should they exist), assuming a default log level of TRACE
+		template<typename TMessage, typename ...T>
+		detail::EnableIfRuntimeMessage<TMessage> Write(const TMessage& message, const T& ...t);
+#ifndef SBLOGGER_LEGACY
+
+		// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), assuming a default log level of TRACE
+		template<typename ...T>
+		void Write(FormatString<detail::Identity<T>...> message, const T& ...t);
+#endif
+
+		// Writes to the stream a message and inserts values into placeholders (should they exist) and finishes with the newline character, assuming a default log level of TRACE
+		template<typename TMessage, typename ...T>
+		detail::EnableIfRuntimeMessage<TMessage> WriteLine(const TMessage& message, const T& ...t);
+#ifndef SBLOGGER_LEGACY
+
+		// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist) and finishes with the newline character, assuming a default log level of TRACE
+		template<typename ...T>
+		void WriteLine(FormatString<detail::Identity<T>...> message, const T& ...t);
+#endif
+
+		//
+		// Generic Methods: Write a level message (depending on the specified "LOG_LEVEL") to a stream 
+		//
+
+		// Writes to the stream a message and inserts values into placeholders (should they exist), of "logLevel" importance
+		template<typename TMessage, typename ...T>
+		detail::EnableIfRuntimeMessage<TMessage> Write(LogLevel logLevel, const TMessage& message, const T& ...t);
+#ifndef SBLOGGER_LEGACY
+
+		// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of "logLevel" importance
+		template<typename ...T>
+		void Write(LogLevel logLevel, FormatString<detail::Identity<T>...> message, const T& ...t);
+#endif
+
+		// Writes to the stream a message and inserts values into placeholders (should they exist) and finishes with the newline character, of "logLevel" importance
+		template<typename TMessage, typename ...T>
+		detail::EnableIfRuntimeMessage<TMessage> WriteLine(LogLevel logLevel, const TMessage& message, const T& ...t);
+#ifndef SBLOGGER_LEGACY
+
+		// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist) and finishes with the newline character, of "logLevel" importance
+		template<typename ...T>
+		void WriteLine(LogLevel logLevel, FormatString<detail::Identity<T>...> message, const T& ...t);
+#endif
+
+		//
+		// Generic Methods: Write a TRACE level message to a stream
+		//
+
+		// Writes to the stream a message and inserts values into placeholders (should they exist), of TRACE importance
+		template<typename TMessage, typename ...T>
+		detail::EnableIfRuntimeMessage<TMessage> Trace(const TMessage& message, const T& ...t);
+#ifndef SBLOGGER_LEGACY
+
+		// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of TRACE importance
+		template<typename ...T>
+		void Trace(FormatString<detail::Identity<T>...> message, const T& ...t);
+#endif
+
+		//
+		// Generic Methods: Write a DEBUG level message to a stream 
+		//
+
+		// Writes to the stream a message and inserts values into placeholders (should they exist), of DEBUG importance
+		template<typename TMessage, typename ...T>
+		detail::EnableIfRuntimeMessage<TMessage> Debug(const TMessage& message, const T& ...t);
+#ifndef SBLOGGER_LEGACY
+
+		// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of DEBUG importance
+		template<typename ...T>
+		void Debug(FormatString<detail::Identity<T>...> message, const T& ...t);
+#endif
+
+		//
+		// Generic Methods: Write a INFO level message to a stream 
+		//
+
+		// Writes to the stream a message and inserts values into placeholders (should they exist), of INFO importance
+		template<typename TMessage, typename ...T>
+		detail::EnableIfRuntimeMessage<TMessage> Info(const TMessage& message, const T& ...t);
+#ifndef SBLOGGER_LEGACY
+
+		// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of INFO importance
+		template<typename ...T>
+		void Info(FormatString<detail::Identity<T>...> message, const T& ...t);
+#endif
+
+		//
+		// Generic Methods: Write a WARN level message to a stream 
+		//
+
+		// Writes to the stream a message and inserts values into placeholders (should they exist), of WARN importance
+		template<typename TMessage, typename ...T>
+		detail::EnableIfRuntimeMessage<TMessage> Warn(const TMessage& message, const T& ...t);
+#ifndef SBLOGGER_LEGACY
+
+		// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of WARN importance
+		template<typename ...T>
+		void Warn(FormatString<detail::Identity<T>...> message, const T& ...t);
+#endif
+
+		//
+		// Generic Methods: Write a ERROR level message to a stream 
+		//
+
+		// Writes to the stream a message and inserts values into placeholders (should they exist), of ERROR importance
+		template<typename TMessage, typename ...T>
+		detail::EnableIfRuntimeMessage<TMessage> Error(const TMessage& message, const T& ...t);
+#ifndef SBLOGGER_LEGACY
+
+		// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of ERROR importance
+		template<typename ...T>
+		void Error(FormatString<detail::Identity<T>...> message, const T& ...t);
+#endif
+
+		//
+		// Generic Methods: Write a CRITICAL level message to a stream 
+		//
+
+		// Writes to the stream a message and inserts values into placeholders (should they exist), of CRITICAL importance
+		template<typename TMessage, typename ...T>
+		detail::EnableIfRuntimeMessage<TMessage> Critical(const TMessage& message, const T& ...t);
+#ifndef SBLOGGER_LEGACY
+
+		// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of CRITICAL importance
+		template<typename ...T>
+		void Critical(FormatString<detail::Identity<T>...> message, const T& ...t);
+#endif
+	};
+	//
+	// Protected constructors
+	//
+	// Initialize a logger, with a format, auto flush (by default)
+	inline Logger::Logger(const std::string& format, bool autoFlush)
+		: m_Format(format), m_FormatProgram(format), m_AutoFlush(autoFlush), m_IndentCount(0u), m_Clock(ClockType::SYSTEM), m_DeferFormatting(false), m_LogLevel(GLOBAL_LOG_LEVEL)
+	{
+		detail::Clock::Prepare(m_Clock);
+	}
+
+	// Initialize a logger, with no format, auto flush (by default)
+	inline Logger::Logger(bool autoFlush) noexcept
+		: m_Format(), m_FormatProgram(), m_AutoFlush(autoFlush), m_IndentCount(0u), m_Clock(ClockType::SYSTEM), m_DeferFormatting(false), m_LogLevel(GLOBAL_LOG_LEVEL)
+	{
+		detail::Clock::Prepare(m_Clock);
+	}
+
+	// Copy constructor
+	inline Logger::Logger(const Logger& other) noexcept
+		: m_Format(other.m_Format), m_FormatProgram(other.m_FormatProgram), m_AutoFlush(other.m_AutoFlush), m_IndentCount(other.m_IndentCount), m_Clock(other.m_Clock), m_DeferFormatting(other.m_DeferFormatting.load(std::memory_order_relaxed)),
+		m_LogLevel(other.m_LogLevel.load(std::memory_order_relaxed))
+	{ }
+
+	//
+	// Protected methods
+	//
+
+	// Get the logging level shared by all loggers (initially the one given by "SBLOGGER_LOG_LEVEL", TRACE by default)
+	inline std::atomic<LogLevel>& Logger::globalLogLevel() noexcept
+	{
+#if SBLOGGER_LOG_LEVEL == SBLOGGER_LEVEL_DEBUG
+		static std::atomic<LogLevel> logLevel(LogLevel::DEBUG);
+#elif SBLOGGER_LOG_LEVEL == SBLOGGER_LEVEL_INFO
+		static std::atomic<LogLevel> logLevel(LogLevel::INFO);
+#elif SBLOGGER_LOG_LEVEL == SBLOGGER_LEVEL_WARN
+		static std::atomic<LogLevel> logLevel(LogLevel::WARN);
+#elif SBLOGGER_LOG_LEVEL == SBLOGGER_LEVEL_ERROR
+		static std::atomic<LogLevel> logLevel(LogLevel::ERROR);
+#elif SBLOGGER_LOG_LEVEL == SBLOGGER_LEVEL_CRITICAL
+		static std::atomic<LogLevel> logLevel(LogLevel::CRITICAL);
+#elif SBLOGGER_LOG_LEVEL == SBLOGGER_LEVEL_OFF
+		static std::atomic<LogLevel> logLevel(LogLevel::OFF);
+#else
+		static std::atomic<LogLevel> logLevel(LogLevel::TRACE);
+#endif
+		return logLevel;
+	}
+
+	// Check if messages of "logLevel" written from "callSite" (if any) are written, the state of the call site taking precedence over the level
+	inline bool Logger::isEnabled(LogLevel logLevel, const CallSite* callSite) const
+	{
+		if (callSite != nullptr)
+		{
+			const CallSiteState state = CallSiteRegistry::GetState(*callSite);
+			if (state != CallSiteState::DEFAULT)
+				return state == CallSiteState::ENABLED;
+		}
+
+		return IsEnabled(logLevel);
+	}
+
+	// Appends the ANSII colour code (e.g. 31 for red) if current stream supports them
+	// (The Logger base class does not do anything with the output, the method needing implementation from derived classes)
+	inline void Logger::appendColour(std::string&, size_t, bool) const noexcept
+	{ }
+
+	// Hands a formatted message of "logLevel", written at "time" (if the format needs it), to the stream (by default, writing it right away using "writeToStream")
+	inline void Logger::dispatchMessage(LogLevel, const std::string& message, std::chrono::system_clock::time_point)
+	{
+		writeToStream(message);
+	}
+
+	// Hands a deferred record (a message whose arguments are not yet formatted) of "logLevel", written at "time" (if the format needs it), to the stream (by default, formatting and writing it right away)
+	inline void Logger::dispatchRecord(LogLevel logLevel, const std::string& record, std::chrono::system_clock::time_point time)
+	{
+		detail::OutputBuffer buffer;
+
+		formatRecord(buffer.Get(), record);
+		dispatchMessage(logLevel, buffer.Get(), time);
+	}
+
+	// Get the time of a message, if the format needs it
+	inline std::chrono::system_clock::time_point Logger::messageTime() const noexcept
+	{
+		return m_FormatProgram.HasTime() ? detail::Clock::Now(m_Clock) : std::chrono::system_clock::time_point();
+	}
+
+	// Get the (monotonic) time elapsed since the first logger was created, if the format needs it (taken along with the time of a message)
+	inline std::chrono::nanoseconds Logger::messageElapsed() const noexcept
+	{
+		return m_FormatProgram.HasElapsed() ? detail::Clock::Elapsed() : std::chrono::nanoseconds::zero();
+	}
+
+	// Check if the stream encodes deferred records itself, so that they should be handed to it unformatted (e.g. a FileLogger in binary mode)
+	inline bool Logger::encodesRecords() const noexcept
+	{
+		return false;
+	}
+
+	// Renders a compiled format into "output" in a single pass, writing "message" in place of "%msg", dates for the given time, the time "elapsed" since the first
+	// logger was created and the source info of "callSite" (if any)
+	inline void Logger::renderFormat(std::string& output, const detail::FormatProgram& program, LogLevel logLevel, const detail::MessageView& message,
+		const CallSite* callSite, std::chrono::system_clock::time_point time, std::chrono::nanoseconds elapsed) const
+	{
+		const std::string& text = program.Text();
+		const detail::DateCache::Entry* dates = program.HasDates() ? &detail::DateCache::Get(program, std::chrono::system_clock::to_time_t(time)) : nullptr;
+		size_t dateIndex = 0u, dateStart;
+		const unsigned long long elapsedNanoseconds = elapsed > std::chrono::nanoseconds::zero() ? static_cast<unsigned long long>(elapsed.count()) : 0u;
+		unsigned long long nanoseconds = program.HasTime()
+			? static_cast<unsigned long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch() % std::chrono::seconds(1)).count()) : 0u;
+
+		for (const detail::FormatToken& token : program.Tokens())
+			switch (token.type)
+			{
+			case detail::FormatTokenType::LITERAL:		output.append(text, token.offset, token.size);							break;
+			case detail::FormatTokenType::MESSAGE:		detail::appendMessage(output, message);									break;
+			case detail::FormatTokenType::LEVEL:		output.append(detail::levelName(logLevel, token.upper));				break;
+			case detail::FormatTokenType::COLOUR:		appendColour(output, token.offset, token.upper);						break;
+			case detail::FormatTokenType::SOURCE:		if (callSite != nullptr) output.append(callSite->fileName);				break;
+			case detail::FormatTokenType::FULL_SOURCE:	if (callSite != nullptr) output.append(callSite->file);					break;
+			case detail::FormatTokenType::LINE:			if (callSite != nullptr) detail::appendDigits(output, callSite->line);	break;
+			case detail::FormatTokenType::FUNCTION:		if (callSite != nullptr) output.append(callSite->function);				break;
+			case detail::FormatTokenType::DATE:
+				dateStart = dateIndex ? dates->ends[dateIndex - 1u] : 0u;
+				output.append(dates->text, dateStart, dates->ends[dateIndex++] - dateStart);
+				break;
+			case detail::FormatTokenType::MILLISECONDS:	detail::appendDigits(output, nanoseconds / 1000000u, 3u);				break;
+			case detail::FormatTokenType::MICROSECONDS:	detail::appendDigits(output, nanoseconds / 1000u, 6u);					break;
+			case detail::FormatTokenType::NANOSECONDS:	detail::appendDigits(output, nanoseconds, 9u);							break;
+			case detail::FormatTokenType::ELAPSED:
+				detail::appendDigits(output, elapsedNanoseconds / 1000000000u);
+				output.push_back('.');
+				detail::appendDigits(output, elapsedNanoseconds / 1000u % 1000000u, 6u);
+				break;
+			}
+	}
+
+	// Append format (if it exists) and replace all "{n}" placeholders with their respective values (n=0,...)
+	inline void Logger::replacePlaceholders(std::string& output, LogLevel logLevel, detail::MessageView message, const detail::FormatArgument* arguments, size_t noArguments,
+		const CallSite* callSite, std::chrono::system_clock::time_point time, std::chrono::nanoseconds elapsed) const
+	{
+		output.reserve(m_IndentCount + m_FormatProgram.Text().size() + message.size + 16u * noArguments + 1u);
+		output.append(m_IndentCount, '\t');
+
+		message.arguments = arguments;
+		message.noArguments = noArguments;
+		renderFormat(output, m_FormatProgram, logLevel, message, callSite, time, elapsed);
+	}
+
+	// Formats a message and its arguments and writes the result to the stream (if "logLevel" is enabled)
+	template<typename ...T>
+	inline void Logger::writeMessage(LogLevel logLevel, const detail::MessageView& message, bool newLine, const T& ...t)
+	{
+		// The call site added by the logging macros (if any) is the last argument
+		const CallSite* const callSites[]{ nullptr, detail::callSiteOf(t)... };
+		const CallSite* const callSite = detail::HasCallSite<T...>::value ? callSites[sizeof...(T)] : nullptr;
+
+		if (SBLOGGER_UNLIKELY(isEnabled(logLevel, callSite)))
+		{
+			const size_t noArguments = sizeof...(T) - (detail::HasCallSite<T...>::value ? 1u : 0u);
+			const detail::FormatArgument arguments[sizeof...(T) + 1u]{ detail::makeArgument(t)... };
+
+			if (m_DeferFormatting.load(std::memory_order_relaxed) && detail::RecordArguments<T...>::ENCODABLE && noArguments <= detail::MAX_RECORD_ARGUMENTS)
+			{
+				deferMessage(std::integral_constant<bool, detail::RecordArguments<T...>::ENCODABLE>(), logLevel, message, newLine, t...);
+				return;
+			}
+
+			const std::chrono::system_clock::time_point time = messageTime();
+			detail::OutputBuffer buffer;
+			replacePlaceholders(buffer.Get(), logLevel, message, arguments, noArguments, callSite, time, messageElapsed());
+			if (newLine)
+				buffer.Get().push_back('\n');
+			dispatchMessage(logLevel, buffer.Get(), time);
+		}
+	}
+
+	// Copies a message and its arguments into a deferred record and hands it to the stream
+	template<typename ...T>
+	inline void Logger::deferMessage(std::true_type, LogLevel logLevel, const detail::MessageView& message, bool newLine, const T& ...t)
+	{
+		const size_t noArguments = sizeof...(T) - (detail::HasCallSite<T...>::value ? 1u : 0u);
+		const CallSite* const callSites[]{ nullptr, detail::callSiteOf(t)... };
+		const std::chrono::system_clock::time_point time = messageTime();
+		const detail::RecordHeader header{ message.isStatic ? message.data : nullptr, message.size,
+			detail::HasCallSite<T...>::value ? callSites[sizeof...(T)] : nullptr, time.time_since_epoch().count(), messageElapsed().count(), logLevel, newLine,
+			static_cast<unsigned char>(noArguments) };
+		detail::OutputBuffer buffer;
+		std::string& record = buffer.Get();
+
+		record.append(reinterpret_cast<const char*>(&header), sizeof(header));
+		if (!message.isStatic)
+			record.append(message.data, message.size);
+		int expand[]{ 0, (detail::RecordArgument<typename std::remove_cv<T>::type>::Encode(record, t), 0)... };
+		(void)expand;
+
+		dispatchRecord(logLevel, record, time);
+	}
+
+	// Used for arguments which cannot be copied into a deferred record (never called)
+	template<typename ...T>
+	inline void Logger::deferMessage(std::false_type, LogLevel, const detail::MessageView&, bool, const T& ...)
+	{ }
+
+	// Formats a deferred record (as created by "deferMessage"), appending the message to "output"
+	inline void Logger::formatRecord(std::string& output, const std::string& record) const
+	{
+		detail::RecordHeader header;
+		detail::RecordArgumentValue values[detail::MAX_RECORD_ARGUMENTS];
+		detail::FormatArgument arguments[detail::MAX_RECORD_ARGUMENTS];
+		size_t position = sizeof(header);
+
+		std::memcpy(&header, record.data(), sizeof(header));
+		if (header.message == nullptr)
+		{
+			header.message = record.data() + position;
+			position += header.messageSize;
+		}
+		detail::decodeRecordArguments(record.data() + position, header.noArguments, values, arguments);
+
+		replacePlaceholders(output, header.level, { header.message, header.messageSize, nullptr, 0u, nullptr, 0u, false }, arguments, header.noArguments, header.callSite,
+			std::chrono::system_clock::time_point(std::chrono::system_clock::duration(header.time)), std::chrono::nanoseconds(header.elapsed));
+		if (header.newLine)
+			output.push_back('\n');
+	}
+
+	// Hands a message of "logLevel" to the stream of "logger" (used by loggers which forward their output to another one, e.g. AsyncLogger)
+	inline void Logger::dispatchMessageOf(Logger& logger, LogLevel logLevel, const std::string& message, std::chrono::system_clock::time_point time)
+	{
+		logger.dispatchMessage(logLevel, message, time);
+	}
+
+	// Hands a deferred record of "logLevel" to the stream of "logger" (used by loggers which forward their output to another one, e.g. AsyncLogger)
+	inline void Logger::dispatchRecordOf(Logger& logger, LogLevel logLevel, const std::string& record, std::chrono::system_clock::time_point time)
+	{
+		logger.dispatchRecord(logLevel, record, time);
+	}
+
+	// Check if the stream of "logger" encodes deferred records itself (used by loggers which forward their output to another one, e.g. AsyncLogger)
+	inline bool Logger::encodesRecordsOf(const Logger& logger) noexcept
+	{
+		return logger.encodesRecords();
+	}
+
+	// Appends the ANSII colour code using the colours supported by "logger" (used by loggers which forward their output to another one, e.g. AsyncLogger)
+	inline void Logger::appendColourOf(const Logger& logger, std::string& output, size_t code, bool bright) noexcept
+	{
+		logger.appendColour(output, code, bright);
+	}
+
+	//
+	// Public methods
+	//
+
+	// Indent (prepend '\t') log, returns the number of indents the final message will contain
+	inline size_t Logger::Indent() noexcept
+	{
+		return ++m_IndentCount;
+	}
+
+	// Dedent (prepend '\t') log, returns the number of indents the final message will contain
+	inline size_t Logger::Dedent() noexcept
+	{
+		return m_IndentCount > 0 ? --m_IndentCount : m_IndentCount;
+	}
+
+	// Set the current logging level to one of the "LogLevel" options (ex.: TRACE, DEBUG, INFO etc).
+	inline void Logger::SetLoggingLevel(const LogLevel& level) noexcept
+	{
+		globalLogLevel().store(level, std::memory_order_relaxed);
+	}
+
+	// Get the current logging level (one of the "LogLevel" options, ex.: TRACE, DEBUG, INFO etc).
+	inline LogLevel Logger::GetLoggingLevel() noexcept
+	{
+		return globalLogLevel().load(std::memory_order_relaxed);
+	}
+
+	// Set the logging level of this logger only, used instead of the global one (e.g. DEBUG for a single logger)
+	inline void Logger::SetLogLevel(LogLevel level) noexcept
+	{
+		m_LogLevel.store(level, std::memory_order_relaxed);
+	}
+
+	// Get the logging level used by this logger (its own, if set, otherwise the global one)
+	inline LogLevel Logger::GetLogLevel() const noexcept
+	{
+		const LogLevel level = m_LogLevel.load(std::memory_order_relaxed);
+		return level == GLOBAL_LOG_LEVEL ? GetLoggingLevel() : level;
+	}
+
+	// Make this logger use the global logging level again
+	inline void Logger::ResetLogLevel() noexcept
+	{
+		m_LogLevel.store(GLOBAL_LOG_LEVEL, std::memory_order_relaxed);
+	}
+
+	// Check if messages of "logLevel" are written, using the logging level of this logger if set, otherwise the global one
+	// (e.g. to skip building the arguments of a message which would not be written)
+	inline bool Logger::IsEnabled(LogLevel logLevel) const noexcept
+	{
+		const LogLevel level = m_LogLevel.load(std::memory_order_relaxed);
+		return logLevel >= (level == GLOBAL_LOG_LEVEL ? globalLogLevel().load(std::memory_order_relaxed) : level);
+	}
+
+	// Check if messages of "callSite" are written, based on its state (see CallSiteRegistry) and, by default, its level
+	inline bool Logger::IsEnabled(const CallSite& callSite) const
+	{
+		return isEnabled(callSite.level, &callSite);
+	}
+
+	// Get the current log format
+	inline std::string Logger::GetFormat() const noexcept
+	{
+		return m_Format;
+	}
+
+	// Set the current log format to "format"
+	inline void Logger::SetFormat(const std::string& format)
+	{
+		m_FormatProgram = detail::FormatProgram(format);
+		m_Format = format;
+	}
+
+	// Get the clock used to timestamp messages
+	inline ClockType Logger::GetClock() const noexcept
+	{
+		return m_Clock;
+	}
+
+	// Set the clock used to timestamp messages (e.g. ClockType::TSC, which is calibrated against the system clock by this call)
+	inline void Logger::SetClock(ClockType clock) noexcept
+	{
+		detail::Clock::Prepare(clock);
+		m_Clock = clock;
+	}
+
+	// Writes to the stream the newline character with a log level of TRACE
+	inline void Logger::WriteLine(LogLevel logLevel)
+	{
+		if (SBLOGGER_UNLIKELY(IsEnabled(logLevel)))
+			dispatchMessage(logLevel, "\n", std::chrono::system_clock::time_point());
+	}
+
+	//
+	// Generic write methods to write a TRACE level message to the stream
+	//
+
+	// Writes to the stream a message and inserts values into placeholders (should they exist) with a default level of TRACE
+	template<typename TMessage, typename ...T>
+	inline detail::EnableIfRuntimeMessage<TMessage> Logger::Write(const TMessage& message, const T& ...t)
+	{
+		const std::string& messageString = message;
+		writeMessage(LogLevel::TRACE, { messageString.data(), messageString.size(), nullptr, 0u, nullptr, 0u, false }, false, t...);
+	}
+#ifndef SBLOGGER_LEGACY
+
+	// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist) with a default level of TRACE
+	template<typename ...T>
+	inline void Logger::Write(FormatString<detail::Identity<T>...> message, const T& ...t)
+	{
+		writeMessage(LogLevel::TRACE, message.View(), false, t...);
+	}
+#endif
+
+	// Writes to the stream a message and inserts values into placeholders (should they exist) and finishes with the newline character with a default level of TRACE
+	template<typename TMessage, typename ...T>
+	inline detail::EnableIfRuntimeMessage<TMessage> Logger::WriteLine(const TMessage& message, const T& ...t)
+	{
+		const std::string& messageString = message;
+		writeMessage(LogLevel::TRACE, { messageString.data(), messageString.size(), nullptr, 0u, nullptr, 0u, false }, true, t...);
+	}
+#ifndef SBLOGGER_LEGACY
+
+	// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist) and finishes with the newline character with a default level of TRACE
+	template<typename ...T>
+	inline void Logger::WriteLine(FormatString<detail::Identity<T>...> message, const T& ...t)
+	{
+		writeMessage(LogLevel::TRACE, message.View(), true, t...);
+	}
+#endif
+
+	//
+	// Generic Methods: Write a level message (depending on the specified "LOG_LEVEL") to a stream 
+	//
+
+	// Writes to the stream a message and inserts values into placeholders (should they exist), with "logLevel" importance
+	template<typename TMessage, typename ...T>
+	inline detail::EnableIfRuntimeMessage<TMessage> Logger::Write(LogLevel logLevel, const TMessage& message, const T& ...t)
+	{
+		const std::string& messageString = message;
+		writeMessage(logLevel, { messageString.data(), messageString.size(), nullptr, 0u, nullptr, 0u, false }, false, t...);
+	}
+#ifndef SBLOGGER_LEGACY
+
+	// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), with "logLevel" importance
+	template<typename ...T>
+	inline void Logger::Write(LogLevel logLevel, FormatString<detail::Identity<T>...> message, const T& ...t)
+	{
+		writeMessage(logLevel, message.View(), false, t...);
+	}
+#endif
+
+	// Writes to the stream a message and inserts values into placeholders (should they exist) and finishes with the newline character, with "logLevel" importance
+	template<typename TMessage, typename ...T>
+	inline detail::EnableIfRuntimeMessage<TMessage> Logger::WriteLine(LogLevel logLevel, const TMessage& message, const T& ...t)
+	{
+		const std::string& messageString = message;
+		writeMessage(logLevel, { messageString.data(), messageString.size(), nullptr, 0u, nullptr, 0u, false }, true, t...);
+	}
+#ifndef SBLOGGER_LEGACY
+
+	// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist) and finishes with the newline character, with "logLevel" importance
+	template<typename ...T>
+	inline void Logger::WriteLine(LogLevel logLevel, FormatString<detail::Identity<T>...> message, const T& ...t)
+	{
+		writeMessage(logLevel, message.View(), true, t...);
+	}
+#endif
+
+	//
+	// Generic Methods: Write a TRACE level message to a stream 
+	//
+
+	// Writes to the stream a message and inserts values into placeholders (should they exist), of TRACE importance
+	template<typename TMessage, typename ...T>
+	inline detail::EnableIfRuntimeMessage<TMessage> Logger::Trace(const TMessage& message, const T& ...t)
+	{
+		const std::string& messageString = message;
+		writeMessage(LogLevel::TRACE, { messageString.data(), messageString.size(), nullptr, 0u, nullptr, 0u, false }, false, t...);
+	}
+#ifndef SBLOGGER_LEGACY
+
+	// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of TRACE importance
+	template<typename ...T>
+	inline void Logger::Trace(FormatString<detail::Identity<T>...> message, const T& ...t)
+	{
+		writeMessage(LogLevel::TRACE, message.View(), false, t...);
+	}
+#endif
+
+	//
+	// Generic Methods: Write a DEBUG level message to a stream 
+	//
+
+	// Writes to the stream a message and inserts values into placeholders (should they exist), of DEBUG importance
+	template<typename TMessage, typename ...T>
+	inline detail::EnableIfRuntimeMessage<TMessage> Logger::Debug(const TMessage& message, const T& ...t)
+	{
+		const std::string& messageString = message;
+		writeMessage(LogLevel::DEBUG, { messageString.data(), messageString.size(), nullptr, 0u, nullptr, 0u, false }, false, t...);
+	}
+#ifndef SBLOGGER_LEGACY
+
+	// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of DEBUG importance
+	template<typename ...T>
+	inline void Logger::Debug(FormatString<detail::Identity<T>...> message, const T& ...t)
+	{
+		writeMessage(LogLevel::DEBUG, message.View(), false, t...);
+	}
+#endif
+
+	//
+	// Generic Methods: Write a INFO level message to a stream 
+	//
+
+	// Writes to the stream a message and inserts values into placeholders (should they exist), of INFO importance
+	template<typename TMessage, typename ...T>
+	inline detail::EnableIfRuntimeMessage<TMessage> Logger::Info(const TMessage& message, const T& ...t)
+	{
+		const std::string& messageString = message;
+		writeMessage(LogLevel::INFO, { messageString.data(), messageString.size(), nullptr, 0u, nullptr, 0u, false }, false, t...);
+	}
+#ifndef SBLOGGER_LEGACY
+
+	// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of INFO importance
+	template<typename ...T>
+	inline void Logger::Info(FormatString<detail::Identity<T>...> message, const T& ...t)
+	{
+		writeMessage(LogLevel::INFO, message.View(), false, t...);
+	}
+#endif
+
+	//
+	// Generic Methods: Write a WARN level message to a stream 
+	//
+
+	// Writes to the stream a message and inserts values into placeholders (should they exist), of WARN importance
+	template<typename TMessage, typename ...T>
+	inline detail::EnableIfRuntimeMessage<TMessage> Logger::Warn(const TMessage& message, const T& ...t)
+	{
+		const std::string& messageString = message;
+		writeMessage(LogLevel::WARN, { messageString.data(), messageString.size(), nullptr, 0u, nullptr, 0u, false }, false, t...);
+	}
+#ifndef SBLOGGER_LEGACY
+
+	// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of WARN importance
+	template<typename ...T>
+	inline void Logger::Warn(FormatString<detail::Identity<T>...> message, const T& ...t)
+	{
+		writeMessage(LogLevel::WARN, message.View(), false, t...);
+	}
+#endif
+
+	//
+	// Generic Methods: Write a ERROR level message to a stream 
+	//
+
+	// Writes to the stream a message and inserts values into placeholders (should they exist), of ERROR importance
+	template<typename TMessage, typename ...T>
+	inline detail::EnableIfRuntimeMessage<TMessage> Logger::Error(const TMessage& message, const T& ...t)
+	{
+		const std::string& messageString = message;
+		writeMessage(LogLevel::ERROR, { messageString.data(), messageString.size(), nullptr, 0u, nullptr, 0u, false }, false, t...);
+	}
+#ifndef SBLOGGER_LEGACY
+
+	// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of ERROR importance
+	template<typename ...T>
+	inline void Logger::Error(FormatString<detail::Identity<T>...> message, const T& ...t)
+	{
+		writeMessage(LogLevel::ERROR, message.View(), false, t...);
+	}
+#endif
+
+	//
+	// Generic Methods: Write a CRITICAL level message to a stream 
+	//
+
+	// Writes to the stream a message and inserts values into placeholders (should they exist), of CRITICAL importance
+	template<typename TMessage, typename ...T>
+	inline detail::EnableIfRuntimeMessage<TMessage> Logger::Critical(const TMessage& message, const T& ...t)
+	{
+		const std::string& messageString = message;
+		writeMessage(LogLevel::CRITICAL, { messageString.data(), messageString.size(), nullptr, 0u, nullptr, 0u, false }, false, t...);
+	}
+#ifndef SBLOGGER_LEGACY
+
+	// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of CRITICAL importance
+	template<typename ...T>
+	inline void Logger::Critical(FormatString<detail::Identity<T>...> message, const T& ...t)
+	{
+		writeMessage(LogLevel::CRITICAL, message.View(), false, t...);
+	}
+#endif
+
+	//
+	// StreamLogger class
+	//
+
+	// Used to log messages to a non-file stream (ex.: STDOUT, STDERR, STDLOG)
+	class StreamLogger : public Logger
+	{
+	protected:
+		//
+		// Protected members
+		//
+
+		StreamType m_StreamType;
+
+		//
+		// Protected methods
+		//
+
+#if defined SBLOGGER_COLOURS || defined SBLOGGER_COLORS
+		// Appends the ANSII escape sequence for the colour found in the format (e.g. "%{red}" or "%^{red}")
+		void appendColour(std::string& output, size_t code, bool bright) const noexcept override;
+#endif	// Appends the ANSII escape sequence for the colour found in the format (e.g. "%{red}" or "%^{red}")
+
+		// Writes string to the sink shared by the loggers of the same STREAM_TYPE (m_StreamType), as a whole
+		void writeToStream(const std::string& str) override;
+
+	public:
+		//
+		// Constructors and destructors
+		//
+
+		// Creates an instance of Logger which outputs to a stream chosen from a STREAM_TYPE
+		// By default uses STREAM_TYPE::STDOUT and no format or auto flush
+		StreamLogger(const StreamType& type = StreamType::STDOUT, const std::string& format = std::string(), bool autoFlush = false);
+
+		// Creates an instance of Logger which outputs to STDOUT. Formats logs and auto flushes based on the parameter "autoFlush"
+		StreamLogger(const std::string& format, bool autoFlush = false);
+
+		// Creates an instance of Logger which outputs to STDOUT. Formats logs and auto flushes based on the parameter "autoFlush"
+		StreamLogger(const char* format, bool autoFlush = false);
+
+		// Creates an instance of Logger which outputs to STDOUT. Formats logs and auto flushes based on the parameter "autoFlush"
+		StreamLogger(bool autoFlush) noexcept;
+
+		// Copy constructor
+
+		// Creates a Logger instance from an already existing one
+		StreamLogger(const StreamLogger& other) noexcept;
+
+		// Destructor
+		
+		// Flush stream before deletion
+		~StreamLogger() override;
+
+		//
+		// Overloaded operators
+		//
+
+		// Assignment operator
+		StreamLogger& operator=(const StreamLogger& other) noexcept;
+
+		//
+		// Public methods
+		//
+
+		// Flush appropriate stream
+		virtual void Flush() noexcept override;
+
+		// Change the logger's stream type (to a different "STREAM_TYPE")
+		void SetStreamType(StreamType streamType);
+
+		// Set if the messages written to "streamType" (by all StreamLoggers) are flushed at the end of every line
+		// By default STDERR is, while STDOUT and STDLOG are only if they are terminals (otherwise the messages are written in batches)
+		static void SetFlushOnNewLine(StreamType streamType, bool flushOnNewLine) noexcept;
+
+		// Get if the messages written to "streamType" (by all StreamLoggers) are flushed at the end of every line
+		static bool GetFlushOnNewLine(StreamType streamType) noexcept;
+	};
+
+	//
+	// Constructors and destructors
+	//
+
+	// Creates an instance of Logger which outputs to a stream chosen from a STREAM_TYPE
+	// By default uses STREAM_TYPE::STDOUT and no format or auto flush
+	inline StreamLogger::StreamLogger(const StreamType& type, const std::string& format, bool autoFlush)
+		: Logger(format, autoFlush), m_StreamType(type)
+	{
+		// Create the sink before the logger, so it is destroyed after it
+		detail::StreamSink::Get(m_StreamType);
+	}
+
+	// Creates an instance of Logger which outputs to STDOUT. Formats logs and auto flushes based on the parameter "autoFlush"
+	inline StreamLogger::StreamLogger(const std::string& format, bool autoFlush)
+		: Logger(format, autoFlush), m_StreamType(StreamType::STDOUT)
+	{
+		detail::StreamSink::Get(m_StreamType);
+	}
+
+	// Creates an instance of Logger which outputs to STDOUT. Formats logs and auto flushes based on the parameter "autoFlush"
+	inline StreamLogger::StreamLogger(const char* format, bool autoFlush)
+		: Logger(format, autoFlush), m_StreamType(StreamType::STDOUT)
+	{
+		detail::StreamSink::Get(m_StreamType);
+	}
+
+	// Creates an instance of Logger which outputs to STDOUT. Formats logs and auto flushes based on the parameter "autoFlush"
+	inline StreamLogger::StreamLogger(bool autoFlush) noexcept
+		: Logger(std::string(), autoFlush), m_StreamType(StreamType::STDOUT)
+	{
+		detail::StreamSink::Get(m_StreamType);
+	}
+
+	// Copy constructor
+
+	// Creates a Logger instance from an already existing one
+	inline StreamLogger::StreamLogger(const StreamLogger& other) noexcept
+		: Logger(other), m_StreamType(other.m_StreamType)
+	{ }
+
+	// Destructor
+
+	// Flush stream before deletion
+	inline StreamLogger::~StreamLogger()
+	{
+		detail::StreamSink::Get(m_StreamType).Flush();
+	}
+
+	//
+	// Protected methods
+	//
+
+#if defined SBLOGGER_COLOURS || defined SBLOGGER_COLORS
+	// Appends the ANSII escape sequence for the colour found in the format (e.g. "%{red}" or "%^{red}")
+	inline void StreamLogger::appendColour(std::string& output, size_t code, bool bright) const noexcept
+	{
+		if (code == 0u)
+			output.append("\033[m");
+		else
+			output.append("\033[").append(std::to_string(bright ? code + 60u : code)).append(1u, 'm');
+	}
+#endif	// Appends the ANSII escape sequence for the colour found in the format (e.g. "%{red}" or "%^{red}")
+
+	// Writes string to the sink shared by the loggers of the same STREAM_TYPE (m_StreamType), as a whole
+	inline void StreamLogger::writeToStream(const std::string& str)
+	{
+		detail::StreamSink::Get(m_StreamType).Write(str, m_AutoFlush);
+	}
+
+	//
+	// Overloaded operators
+	//
+
+	// Assignment operator
+	inline StreamLogger& StreamLogger::operator=(const StreamLogger& other) noexcept
+	{
+		if (this != &other)
+		{
+			m_AutoFlush = other.m_AutoFlush;
+			m_Format = other.m_Format;
+			m_FormatProgram = other.m_FormatProgram;
+			m_IndentCount = other.m_IndentCount;
+			m_Clock = other.m_Clock;
+			m_LogLevel.store(other.m_LogLevel.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			m_StreamType = other.m_StreamType;
+		}
+
+		return *this;
+	}
+
+	//
+	// Public methods
+	//
+
+	// Flush appropriate stream
+	inline void StreamLogger::Flush() noexcept
+	{
+		detail::StreamSink::Get(m_StreamType).Flush();
+	}
+
+	// Change the logger's stream type (to a different "STREAM_TYPE")
+	inline void StreamLogger::SetStreamType(StreamType streamType)
+	{
+		detail::StreamSink::Get(streamType);
+		m_StreamType = streamType;
+	}
+
+	// Set if the messages written to "streamType" (by all StreamLoggers) are flushed at the end of every line
+	// By default STDERR is, while STDOUT and STDLOG are only if they are terminals (otherwise the messages are written in batches)
+	inline void StreamLogger::SetFlushOnNewLine(StreamType streamType, bool flushOnNewLine) noexcept
+	{
+		detail::StreamSink::Get(streamType).SetFlushOnNewLine(flushOnNewLine);
+	}
+
+	// Get if the messages written to "streamType" (by all StreamLoggers) are flushed at the end of every line
+	inline bool StreamLogger::GetFlushOnNewLine(StreamType streamType) noexcept
+	{
+		return detail::StreamSink::Get(streamType).GetFlushOnNewLine();
+	}
+
+	//
+	// FileLogger class
+	//
+
+	// Used to log messages to a file stream
+	class FileLogger : public Logger
+	{
+	protected:
+		//
+		// Protected members
+		//
+
+#ifdef SBLOGGER_LEGACY // Pre C++17 Compilers
+		std::string m_FilePath;
+#else
+		std::filesystem::path m_FilePath;
+#endif
+		detail::FileSink m_FileSink;
+		std::mutex m_Mutex;
+		std::atomic<LogLevel> m_FlushLevel;
+		std::atomic<LogLevel> m_SyncLevel;
+		std::chrono::milliseconds m_FlushInterval;
+		size_t m_FlushTask;
+		Compression m_Compression;
+		std::atomic<bool> m_Binary;
+		detail::BinaryEncoder m_BinaryEncoder;
+
+		//
+		// Protected methods
+		//
+
+		// Writes string to file stream and flush if auto flush is set
+		virtual void writeToStream(const std::string& str) override;
+
+		// Writes a message of "logLevel" to the file stream, flushing it if auto flush is set or required by its level
+		// (in binary mode it is encoded first, "isRecord" telling if it is a deferred record or a formatted message, and "time" when it was written)
+		void writeToFile(const std::string& str, LogLevel logLevel, std::chrono::system_clock::time_point time = std::chrono::system_clock::time_point(),
+			bool isRecord = false);
+
+		// Called after a message is written to the file stream, with the mutex held (e.g. for rotating the file once it is too large)
+		virtual void afterWrite();
+
+		// Hands a formatted message of "logLevel" to the file stream, so that it is flushed based on its level
+		void dispatchMessage(LogLevel logLevel, const std::string& message, std::chrono::system_clock::time_point time) override;
+
+		// Hands a deferred record of "logLevel" to the file stream, encoded as it is in binary mode (otherwise formatting it first)
+		void dispatchRecord(LogLevel logLevel, const std::string& record, std::chrono::system_clock::time_point time) override;
+
+		// Check if deferred records are encoded by the logger, instead of being formatted (in binary mode)
+		bool encodesRecords() const noexcept override;
+
+		// Flushes the file stream, returning the next time it should be flushed at (run by the shared scheduler every "m_FlushInterval")
+		std::chrono::system_clock::time_point flushPeriodically();
+
+		// Stops flushing the file stream periodically (if started)
+		void stopFlushing();
+
+		// Replaces the placeholders found in a file path (e.g. dates), using the same syntax as the log format
+		std::string formatFilePath(const std::string& filePath) const;
+
+		// Compresses the closed file "filePath" to "outputPath" in the background, then calls "done" with the size of the output (if set, otherwise
+		// deleting the file once compressed)
+		void compressFile(const std::string& filePath, const std::string& outputPath, Compression compression, std::function<void(bool, size_t)> done);
+
+	public:
+		//
+		// Constructors and destructors
+		//
+
+		// Deleted to prevent usage without providing a file path
+		FileLogger() = delete;
+
+		// Creates an instance of FileLogger which outputs to a file stream given by the "filePath" parameter
+		// By default there is no formatting and auto flush is set to true
+		FileLogger(const char* filePath, const char* format = nullptr, bool autoFlush = true);
+
+		// Creates an instance of FileLogger which outputs to a file stream given by the "filePath" parameter
+		// By default there is no formatting and auto flush is set to true
+		FileLogger(const char* filePath, const std::string& format, bool autoFlush = true);
+
+		// Creates an instance of FileLogger which outputs to a file stream given by the "filePath" parameter
+		// By default there is no formatting and auto flush is set to true
+		FileLogger(const std::string& filePath, const std::string& format = std::string(), bool autoFlush = true);
+
+		// Copy constructor
+
+		FileLogger(const FileLogger& other) = delete;
+
+		// Move constructor
+
+		FileLogger(FileLogger&& other) = delete;
+
+		// Destructor
+
+		// Flush and close stream if open
+		virtual ~FileLogger() override;
+
+		//
+		// Overloaded operators
+		//
+
+		// Assignment operator (deleted since having two streams for the same file causes certain output not to be written).
+		FileLogger& operator=(const FileLogger& other) = delete;
+
+		//
+		// Public methods
+		//
+
+		// Get the file path
+#ifdef SBLOGGER_LEGACY
+		std::string GetFilePath() const noexcept;
+#else
+		std::filesystem::path GetFilePath() const noexcept;
+#endif
+
+		// Flush file stream
+		virtual void Flush() noexcept override;
+
+		// Indent (prepend '\t') log, returns the number of indents the final message will contain
+		virtual size_t Indent() noexcept override;
+
+		// Dedent (remove '\t') log, returns the number of indents the final message will contain
+		virtual size_t Dedent() noexcept override;
+
+		// Clear log file
+		virtual void ClearLogs() noexcept;
+
+		// Set the number of characters buffered before being written to the file, when auto flush is not set (0 to write every message right away)
+		void SetBufferSize(size_t bufferSize) noexcept;
+
+		// Get the number of characters buffered before being written to the file, when auto flush is not set
+		size_t GetBufferSize() noexcept;
+
+		// Reserve "size" bytes of disk space for the messages written next (without changing the size of the file), returns false if not supported (only on Linux)
+		bool Preallocate(size_t size) noexcept;
+
+		// Set the level from which messages are flushed right away, even if auto flush is not set (ex.: ERROR), OFF by default for none
+		void SetFlushLevel(LogLevel flushLevel) noexcept;
+
+		// Get the level from which messages are flushed right away
+		LogLevel GetFlushLevel() const noexcept;
+
+		// Set the level from which messages are also stored on the disk right away (using fdatasync on POSIX systems), OFF by default for none
+		void SetSyncLevel(LogLevel syncLevel) noexcept;
+
+		// Get the level from which messages are also stored on the disk right away
+		LogLevel GetSyncLevel() const noexcept;
+
+		// Set the interval at which buffered messages are flushed by a background thread (0 by default, for none)
+		void SetFlushInterval(std::chrono::milliseconds flushInterval);
+
+		// Get the interval at which buffered messages are flushed by a background thread
+		std::chrono::milliseconds GetFlushInterval() noexcept;
+
+		// Set how the files closed by rotating loggers (DailyLogger, RotatingFileLogger) are compressed in the background, NONE by default
+		// (GZIP is only available if "SBLOGGER_ZLIB" is defined, LZ4 being used otherwise)
+		void SetCompression(Compression compression) noexcept;
+
+		// Get how the files closed by rotating loggers are compressed
+		Compression GetCompression() noexcept;
+
+		// Set the maximum number of bytes read per second by the thread compressing files (for all loggers), 8 MiB by default (0 for no limit)
+		static void SetCompressionRate(size_t bytesPerSecond) noexcept;
+
+		// Get the maximum number of bytes read per second by the thread compressing files
+		static size_t GetCompressionRate() noexcept;
+
+		// Set if messages are written in a compact binary format (read with BinaryLogReader or the sblog-decode tool) instead of as text, false by default
+		// Messages are then formatted when read, only their arguments (numbers and strings) being written, so it should be set before writing to the file
+		void SetBinary(bool binary);
+
+		// Get if messages are written in the compact binary format
+		bool GetBinary() const noexcept;
+	};
+
+	//
+	// Constructors and destructors
+	//
+
+	// Creates an instance of FileLogger which outputs to a file stream given by the "filePath" parameter
+	// By default there is no formatting and auto flush is set to true
+	inline FileLogger::FileLogger(const char* filePath, const char* format, bool autoFlush)
+		: Logger(format == nullptr ? "" : format, autoFlush), m_FlushLevel(LogLevel::OFF), m_SyncLevel(LogLevel::OFF), m_FlushInterval(0), m_FlushTask(0u), m_Compression(Compression::NONE), m_Binary(false), m_BinaryEncoder()
+	{
+		// Create the scheduler and the compressor before the logger, so they are destroyed after it
+		detail::Scheduler::Get();
+		detail::Compressor::Get();
+
+		if (filePath == nullptr || filePath[0] == '\0') throw NullOrEmptyPathException();
+
+		std::string formattedFilePath(formatFilePath(filePath));
+#ifdef SBLOGGER_LEGACY // Pre C++17 Compilers
+		m_FilePath = formattedFilePath;
+		if (!std::regex_match(m_FilePath, SBLOGGER_FILE_PATH_REGEX)) throw InvalidFilePathException(m_FilePath);
+#else
+		m_FilePath = std::filesystem::path(formattedFilePath);
+		// Check file path for null, empty, inexistent or whitespace only paths and filenames
+		if (!m_FilePath.has_filename() || !m_FilePath.has_extension()) throw NullOrEmptyPathException();
+		if (m_FilePath.filename().replace_extension().string().find_first_not_of(' ') == std::string::npos) throw NullOrWhitespaceNameException();
+		auto parentPath = m_FilePath.parent_path();
+		if (!parentPath.empty() && !std::filesystem::directory_entry(parentPath).exists()) throw InvalidFilePathException(formattedFilePath);
+#endif
+		m_FileSink.Open(formattedFilePath, false);
+
+#ifdef SBLOGGER_LEGACY // Pre C++17 Compilers
+		if (!m_FileSink.IsOpen()) throw InvalidFilePathException(m_FilePath);
+#else
+		if (!m_FileSink.IsOpen()) throw InvalidFilePathException(formattedFilePath);
+#endif
+	}
+
+	// Creates an instance of FileLogger which outputs to a file stream given by the "filePath" parameter
+	// By default there is no formatting and auto flush is set to true
+	inline FileLogger::FileLogger(const char* filePath, const std::string& format, bool autoFlush)
+		: Logger(format, autoFlush), m_FlushLevel(LogLevel::OFF), m_SyncLevel(LogLevel::OFF), m_FlushInterval(0), m_FlushTask(0u), m_Compression(Compression::NONE), m_Binary(false), m_BinaryEncoder()
+	{
+		// Create the scheduler and the compressor before the logger, so they are destroyed after it
+		detail::Scheduler::Get();
+		detail::Compressor::Get();
+
+		if (filePath == nullptr || filePath[0] == '\0') throw NullOrEmptyPathException();
+
+		std::string formattedFilePath(formatFilePath(filePath));
+#ifdef SBLOGGER_LEGACY // Pre C++17 Compilers
+		m_FilePath = formattedFilePath;
+		if (!std::regex_match(m_FilePath, SBLOGGER_FILE_PATH_REGEX)) throw InvalidFilePathException(m_FilePath);
+#else
+		m_FilePath = std::filesystem::path(formattedFilePath);
+		// Check file path for null, empty, inexistent or whitespace only paths and filenames
+		if (!m_FilePath.has_filename() || !m_FilePath.has_extension()) throw NullOrEmptyPathException();
+		if (m_FilePath.filename().replace_extension().string().find_first_not_of(' ') == std::string::npos) throw NullOrWhitespaceNameException();
+		if (!std::filesystem::directory_entry(m_FilePath.parent_path()).exists()) throw InvalidFilePathException(formattedFilePath);
+#endif
+		m_FileSink.Open(formattedFilePath, false);
+
+#ifdef SBLOGGER_LEGACY // Pre C++17 Compilers
+		if (!m_FileSink.IsOpen()) throw InvalidFilePathException(m_FilePath);
+#else
+		if (!m_FileSink.IsOpen()) throw InvalidFilePathException(formattedFilePath);
+#endif
+	}
+
+	// Creates an instance of FileLogger which outputs to a file stream given by the "filePath" parameter
+	// By default there is no formatting and auto flush is set to true
+	inline FileLogger::FileLogger(const std::string& filePath, const std::string& format, bool autoFlush)
+		: Logger(format, autoFlush), m_FlushLevel(LogLevel::OFF), m_SyncLevel(LogLevel::OFF), m_FlushInterval(0), m_FlushTask(0u), m_Compression(Compression::NONE), m_Binary(false), m_BinaryEncoder()
+	{
+		// Create the scheduler and the compressor before the logger, so they are destroyed after it
+		detail::Scheduler::Get();
+		detail::Compressor::Get();
+
+		std::string formattedFilePath(formatFilePath(filePath));
+#ifdef SBLOGGER_LEGACY // Pre C++17 Compilers
+		m_FilePath = formattedFilePath;
+		if (!std::regex_match(m_FilePath, SBLOGGER_FILE_PATH_REGEX)) throw InvalidFilePathException(m_FilePath);
+#else
+		m_FilePath = std::filesystem::path(formattedFilePath);
+		// Check file path for null, empty, inexistent or whitespace only paths and filenames
+		if (!m_FilePath.has_filename() || !m_FilePath.has_extension()) throw NullOrEmptyPathException();
+		if (m_FilePath.filename().replace_extension().string().find_first_not_of(' ') == std::string::npos) throw NullOrWhitespaceNameException();
+		if (!std::filesystem::directory_entry(m_FilePath.parent_path()).exists()) throw InvalidFilePathException(formattedFilePath);
+#endif
+		m_FileSink.Open(formattedFilePath, false);
+
+#ifdef SBLOGGER_LEGACY // Pre C++17 Compilers
+		if (!m_FileSink.IsOpen()) throw InvalidFilePathException(m_FilePath);
+#else
+		if (!m_FileSink.IsOpen()) throw InvalidFilePathException(formattedFilePath);
+#endif
+	}
+
+	// Destructor
+
+	// Flush and close stream if open
+	inline FileLogger::~FileLogger()
+	{
+		stopFlushing();
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_FileSink.Close();
+	}
+
+	//
+	// Private methods
+	//
+
+	// Replaces the placeholders found in a file path (e.g. dates), using the same syntax as the log format
+	inline std::string FileLogger::formatFilePath(const std::string& filePath) const
+	{
+		std::string formattedFilePath;
+		renderFormat(formattedFilePath, detail::FormatProgram(filePath, false), GetLogLevel(), { nullptr, 0u, nullptr, 0u, nullptr, 0u, false }, nullptr,
+			std::chrono::system_clock::now(), detail::Clock::Elapsed());
+
+		return formattedFilePath;
+	}
+
+	// Compresses the closed file "filePath" to "outputPath" in the background, then calls "done" with the size of the output (if set, otherwise
+	// deleting the file once compressed)
+	inline void FileLogger::compressFile(const std::string& filePath, const std::string& outputPath, Compression compression,
+		std::function<void(bool, size_t)> done)
+	{
+		// Opened right away, so that the file can still be read if it is renamed or deleted before being compressed
+		std::FILE* source = std::fopen(filePath.c_str(), "rb");
+		if (source == nullptr)
+			return;
+
+		// Files with no callback do not need the logger, so they have no owner and are still compressed once it is destroyed
+		const void* owner = done ? this : nullptr;
+		detail::Compressor::Get().Add(detail::Compressor::Job{ source, filePath, outputPath, compression, owner, std::move(done) });
+	}
+
+	// Writes string to file stream and flush if auto flush is set
+	inline void FileLogger::writeToStream(const std::string& str)
+	{
+		writeToFile(str, LogLevel::OFF);
+	}
+
+	// Writes a message of "logLevel" to the file stream, flushing it if auto flush is set or required by its level
+	// (in binary mode it is encoded first, "isRecord" telling if it is a deferred record or a formatted message, and "time" when it was written)
+	inline void FileLogger::writeToFile(const std::string& str, LogLevel logLevel, std::chrono::system_clock::time_point time, bool isRecord)
+	{
+		// Messages with no level (OFF) are only flushed by auto flush
+		const bool sync = logLevel != LogLevel::OFF && logLevel >= m_SyncLevel.load(std::memory_order_relaxed);
+		const bool flush = m_AutoFlush || sync || (logLevel != LogLevel::OFF && logLevel >= m_FlushLevel.load(std::memory_order_relaxed));
+		const bool binary = isRecord || m_Binary.load(std::memory_order_relaxed);
+
+		// Binary messages always have a time, even if the format does not show it
+		if (binary && time == std::chrono::system_clock::time_point())
+			time = detail::Clock::Now(m_Clock);
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		if (!m_FileSink.IsOpen())
+#ifdef SBLOGGER_LEGACY // Pre C++17 Compilers
+			std::cerr << "The file stream " + m_FilePath + " is not opened.";
+#else
+			std::cerr << "The file stream " + m_FilePath.string() + " is not opened.";
+#endif
+		else
+		{
+			if (binary)
+			{
+				// Encoded with the mutex held, so that the dictionary entries are written before the records using them
+				detail::OutputBuffer buffer;
+				if (isRecord)
+					m_BinaryEncoder.AppendRecord(buffer.Get(), m_Format, str, time, m_IndentCount);
+				else
+					m_BinaryEncoder.AppendText(buffer.Get(), m_Format, logLevel, str, time);
+				m_FileSink.Write(buffer.Get(), flush);
+			}
+			else
+				m_FileSink.Write(str, flush);
+			if (sync)
+				m_FileSink.Sync();
+			afterWrite();
+		}
+	}
+
+	// Called after a message is written to the file stream, with the mutex held (e.g. for rotating the file once it is too large)
+	inline void FileLogger::afterWrite()
+	{ }
+
+	// Hands a formatted message of "logLevel" to the file stream, so that it is flushed based on its level
+	inline void FileLogger::dispatchMessage(LogLevel logLevel, const std::string& message, std::chrono::system_clock::time_point time)
+	{
+		writeToFile(message, logLevel, time);
+	}
+
+	// Hands a deferred record of "logLevel" to the file stream, encoded as it is in binary mode (otherwise formatting it first)
+	inline void FileLogger::dispatchRecord(LogLevel logLevel, const std::string& record, std::chrono::system_clock::time_point time)
+	{
+		if (m_Binary.load(std::memory_order_relaxed))
+			writeToFile(record, logLevel, time, true);
+		else
+			Logger::dispatchRecord(logLevel, record, time);
+	}
+
+	// Check if deferred records are encoded by the logger, instead of being formatted (in binary mode)
+	inline bool FileLogger::encodesRecords() const noexcept
+	{
+		return m_Binary.load(std::memory_order_relaxed);
+	}
+
+	// Flushes the file stream, returning the next time it should be flushed at (run by the shared scheduler every "m_FlushInterval")
+	inline std::chrono::system_clock::time_point FileLogger::flushPeriodically()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		m_FileSink.Flush();
+		return std::chrono::system_clock::now() + m_FlushInterval;
+	}
+
+	// Stops flushing the file stream periodically (if started)
+	inline void FileLogger::stopFlushing()
+	{
+		size_t flushTask;
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			flushTask = m_FlushTask;
+			m_FlushTask = 0u;
+		}
+
+		// Waits for the task if it is running, thus without holding the mutex it needs
+		detail::Scheduler::Get().Remove(flushTask);
+	}
+
+	//
+	// Public methods
+	//
+
+	// Get the file path
+#ifdef SBLOGGER_LEGACY
+	std::string FileLogger::GetFilePath() const noexcept
+#else
+	std::filesystem::path FileLogger::GetFilePath() const noexcept
+#endif
+	{
+		return m_FilePath;
+	}
+
+	// Flush file stream
+	inline void FileLogger::Flush() noexcept
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_FileSink.Flush();
+	}
+
+	// Indent (prepend '\t') log, returns the number of indents the final message will contain
+	inline size_t FileLogger::Indent() noexcept
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return ++m_IndentCount;
+	}
+
+	// Dedent (prepend '\t') log, returns the number of indents the final message will contain
+	inline size_t FileLogger::Dedent() noexcept
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_IndentCount > 0 ? --m_IndentCount : m_IndentCount;
+	}
+
+	// Clear log file
+	inline void FileLogger::ClearLogs() noexcept
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		if (m_FileSink.IsOpen())
+		{
+#ifdef SBLOGGER_LEGACY
+			m_FileSink.Open(m_FilePath, true);
+#else
+			m_FileSink.Open(m_FilePath.string(), true);
+#endif
+			m_BinaryEncoder.Reset();
+		}
+	}
+
+	// Set the number of characters buffered before being written to the file, when auto flush is not set (0 to write every message right away)
+	inline void FileLogger::SetBufferSize(size_t bufferSize) noexcept
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_FileSink.SetBufferSize(bufferSize);
+	}
+
+	// Get the number of characters buffered before being written to the file, when auto flush is not set
+	inline size_t FileLogger::GetBufferSize() noexcept
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_FileSink.GetBufferSize();
+	}
+
+	// Reserve "size" bytes of disk space for the messages written next (without changing the size of the file), returns false if not supported (only on Linux)
+	inline bool FileLogger::Preallocate(size_t size) noexcept
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_FileSink.Preallocate(size);
+	}
+
+	// Set the level from which messages are flushed right away, even if auto flush is not set (ex.: ERROR), OFF by default for none
+	inline void FileLogger::SetFlushLevel(LogLevel flushLevel) noexcept
+	{
+		m_FlushLevel.store(flushLevel, std::memory_order_relaxed);
+	}
+
+	// Get the level from which messages are flushed right away
+	inline LogLevel FileLogger::GetFlushLevel() const noexcept
+	{
+		return m_FlushLevel.load(std::memory_order_relaxed);
+	}
+
+	// Set the level from which messages are also stored on the disk right away (using fdatasync on POSIX systems), OFF by default for none
+	inline void FileLogger::SetSyncLevel(LogLevel syncLevel) noexcept
+	{
+		m_SyncLevel.store(syncLevel, std::memory_order_relaxed);
+	}
+
+	// Get the level from which messages are also stored on the disk right away
+	inline LogLevel FileLogger::GetSyncLevel() const noexcept
+	{
+		return m_SyncLevel.load(std::memory_order_relaxed);
+	}
+
+	// Set the interval at which buffered messages are flushed by a background thread (0 by default, for none)
+	inline void FileLogger::SetFlushInterval(std::chrono::milliseconds flushInterval)
+	{
+		// Reschedule the task, so that it is next run after the new interval
+		stopFlushing();
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_FlushInterval = flushInterval;
+		if (m_FlushInterval > std::chrono::milliseconds(0) && m_FlushTask == 0u)
+			m_FlushTask = detail::Scheduler::Get().Add(std::chrono::system_clock::now() + m_FlushInterval,
+				[this](std::chrono::system_clock::time_point) { return flushPeriodically(); });
+	}
+
+	// Get the interval at which buffered messages are flushed by a background thread
+	inline std::chrono::milliseconds FileLogger::GetFlushInterval() noexcept
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_FlushInterval;
+	}
+
+	// Set how the files closed by rotating loggers (DailyLogger, RotatingFileLogger) are compressed in the background, NONE by default
+	// (GZIP is only available if "SBLOGGER_ZLIB" is defined, LZ4 being used otherwise)
+	inline void FileLogger::SetCompression(Compression compression) noexcept
+	{
+#ifndef SBLOGGER_ZLIB
+		if (compression == Compression::GZIP)
+			compression = Compression::LZ4;
+#endif
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_Compression = compression;
+	}
+
+	// Get how the files closed by rotating loggers are compressed
+	inline Compression FileLogger::GetCompression() noexcept
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_Compression;
+	}
+
+	// Set the maximum number of bytes read per second by the thread compressing files (for all loggers), 8 MiB by default (0 for no limit)
+	inline void FileLogger::SetCompressionRate(size_t bytesPerSecond) noexcept
+	{
+		detail::Compressor::Get().SetRate(bytesPerSecond);
+	}
+
+	// Get the maximum number of bytes read per second by the thread compressing files
+	inline size_t FileLogger::GetCompressionRate() noexcept
+	{
+		return detail::Compressor::Get().GetRate();
+	}
+
+	// Set if messages are written in a compact binary format (read with BinaryLogReader or the sblog-decode tool) instead of as text, false by default
+	// Messages are then formatted when read, only their arguments (numbers and strings) being written, so it should be set before writing to the file
+	inline void FileLogger::SetBinary(bool binary)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		// Deferring the formatting makes the messages reach the logger as records (except the ones whose arguments cannot be copied, written as text)
+		m_DeferFormatting.store(binary, std::memory_order_relaxed);
+		m_Binary.store(binary, std::memory_order_relaxed);
+		m_BinaryEncoder.Reset();
+	}
+
+	// Get if messages are written in the compact binary format
+	inline bool FileLogger::GetBinary() const noexcept
+	{
+		return m_Binary.load(std::memory_order_relaxed);
+	}
+
+	//
+	// DailyLogger class
+	//
+
+	// Used to log messages to a file stream, recreated daily at the specified time point
+	class DailyLogger : public FileLogger
+	{
+		//
+		// Private members
+		//
+
+		size_t m_FileChangeTask;
+		std::string m_FileNameFormat;
+		int m_Hours, m_Minutes, m_Seconds;
 		
-		addIndent(message);
-		addPadding(message);
-		addColours(message);
-		replacePredefinedPlaceholders(message);
-		replaceCurrentLevel(message);
-		if(hasMacros)
-			replaceOthers(message, items[noArguments - 3u].c_str(), items[noArguments - 2u].c_str(), items[noArguments - 1u].c_str());
-		else
-			replaceOthers(message, nullptr, nullptr, nullptr);
-		replaceDateFormats(message);
+		//
+		// Protected methods
+		//
+
+		// Change the current file (opening the new one and closing the current one), returning the next time it should be changed at
+		// (run by the shared scheduler at "changeTime", the time of day provided)
+		std::chrono::system_clock::time_point changeFile(std::chrono::system_clock::time_point changeTime);
+
+		// Open the file for the current time and replace the current one with it (the writers only wait for the swap, not for the file to be created)
+		void swapFile();
+
+		// Check and set the time of day the file is changed at, then schedule changing it
+		void start(int hour, int minutes, int seconds);
+
+		// Get the first time point after "after" at which the file should be changed (the next occurrence of the time of day set)
+		std::chrono::system_clock::time_point nextChangeTime(std::chrono::system_clock::time_point after) const;
+
+	public:
+		//
+		// Constructors and destructors
+		//
+
+		// Deleted to prevent usage without providing a file path and time to change it at
+		DailyLogger() = delete;
+
+		// Creates an instance of DailyLogger which outputs to a file stream given by the "filePath" parameter, which will be recreated at the specified interval
+		// By default there is no formatting and auto flush is set to true
+		DailyLogger(const char* filePath, const char* format = nullptr, int hour = 0, int minutes = 0, int seconds = 0, bool autoFlush = true);
+
+		// Creates an instance of DailyLogger which outputs to a file stream given by the "filePath" parameter, which will be recreated at the specified interval
+		// By default there is no formatting and auto flush is set to true
+		DailyLogger(const char* filePath, const std::string& format, int hour = 0, int minutes = 0, int seconds = 0, bool autoFlush = true);
+
+		// Creates an instance of DailyLogger which outputs to a file stream given by the "filePath" parameter, which will be recreated at the specified interval
+		// By default there is no formatting and auto flush is set to true
+		DailyLogger(const std::string& filePath, const std::string& format = std::string(), int hour = 0, int minutes = 0, int seconds = 0, bool autoFlush = true);
+
+		// Creates an instance of DailyLogger which outputs to a file stream given by the "filePath" parameter, which will be recreated at the specified interval
+		// By default there is no formatting and auto flush is set to true
+		DailyLogger(const std::string&& filePath, const std::string&& format = std::string(), int hour = 0, int minutes = 0, int seconds = 0, bool autoFlush = true);
+
+		// Copy constructor
+
+		DailyLogger(const DailyLogger& other) = delete;
+
+		// Move constructor
+
+		DailyLogger(DailyLogger&& other) = delete;
+
+		// Destructor
+
+		// Flush and close stream if open
+		~DailyLogger() override;
+
+		//
+		// Overloaded operators
+		//
+
+		// Assignment operator (deleted since having two streams for the same file causes certain output not to be written).
+		DailyLogger& operator=(const DailyLogger& other) = delete;
+	};
+
+	//
+	// Constructors and destructors
+	//
+
+	// Creates an instance of DailyLogger which outputs to a file stream given by the "filePath" parameter, which will be recreated at the specified interval
+	// By default there is no formatting and auto flush is set to true
+	inline DailyLogger::DailyLogger(const char* filePath, const char* format, int hour, int minutes, int seconds, bool autoFlush)
+		: FileLogger(filePath, format, autoFlush), m_FileChangeTask(0u), m_FileNameFormat(filePath), m_Hours(0), m_Minutes(0), m_Seconds(0)
+	{
+		start(hour, minutes, seconds);
+	}
+
+	// Creates an instance of DailyLogger which outputs to a file stream given by the "filePath" parameter, which will be recreated at the specified interval
+	// By default there is no formatting and auto flush is set to true
+	inline DailyLogger::DailyLogger(const char* filePath, const std::string& format, int hour, int minutes, int seconds, bool autoFlush)
+		: FileLogger(filePath, format, autoFlush), m_FileChangeTask(0u), m_FileNameFormat(filePath), m_Hours(0), m_Minutes(0), m_Seconds(0)
+	{
+		start(hour, minutes, seconds);
+	}
+
+	// Creates an instance of DailyLogger which outputs to a file stream given by the "filePath" parameter, which will be recreated at the specified interval
+	// By default there is no formatting and auto flush is set to true
+	inline DailyLogger::DailyLogger(const std::string& filePath, const std::string& format, int hour, int minutes, int seconds, bool autoFlush)
+		: FileLogger(filePath, format, autoFlush), m_FileChangeTask(0u), m_FileNameFormat(filePath), m_Hours(0), m_Minutes(0), m_Seconds(0)
+	{
+		start(hour, minutes, seconds);
+	}
+
+	// Creates an instance of DailyLogger which outputs to a file stream given by the "filePath" parameter, which will be recreated at the specified interval
+	// By default there is no formatting and auto flush is set to true
+	inline DailyLogger::DailyLogger(const std::string&& filePath, const std::string&& format, int hour, int minutes, int seconds, bool autoFlush)
+		: FileLogger(filePath, format, autoFlush), m_FileChangeTask(0u), m_FileNameFormat(filePath), m_Hours(0), m_Minutes(0), m_Seconds(0)
+	{
+		start(hour, minutes, seconds);
+	}
+
+	// Destructor
+
+	// Flush and close stream if open
+	inline DailyLogger::~DailyLogger()
+	{
+		stopFlushing();
+
+		// Waits for the file to be changed if it is being changed, thus without holding the mutex of the writers
+		detail::Scheduler::Get().Remove(m_FileChangeTask);
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_FileSink.Close();
+	}
+
+	//
+	// Protected methods
+	//
+
+	// Check and set the time of day the file is changed at, then schedule changing it
+	inline void DailyLogger::start(int hour, int minutes, int seconds)
+	{
+		if (hour < 0 || hour > 23)			throw TimeRangeException();
+		if (minutes < 0 || minutes > 59)	throw TimeRangeException();
+		if (seconds < 0 || seconds > 59)	throw TimeRangeException();
+
+		m_Hours = hour;
+		m_Minutes = minutes;
+		m_Seconds = seconds;
+		m_FileChangeTask = detail::Scheduler::Get().Add(nextChangeTime(std::chrono::system_clock::now()),
+			[this](std::chrono::system_clock::time_point changeTime) { return changeFile(changeTime); });
+	}
+
+	// Get the first time point after "after" at which the file should be changed (the next occurrence of the time of day set)
+	inline std::chrono::system_clock::time_point DailyLogger::nextChangeTime(std::chrono::system_clock::time_point after) const
+	{
+// Set the date using time_t and mktime (pre C++20)
+#ifdef SBLOGGER_OLD_DATES
+		std::tm newTime{};
+		std::time_t tt;
+
+		detail::localTime(std::chrono::system_clock::to_time_t(after), newTime);
+		for (int day = 0; day < 2; ++day)
+		{
+			newTime.tm_sec = m_Seconds;
+			newTime.tm_min = m_Minutes;
+			newTime.tm_hour = m_Hours;
+			newTime.tm_mday += day;
+			newTime.tm_isdst = -1;
+			tt = std::mktime(&newTime);
+			if (std::chrono::system_clock::from_time_t(tt) > after)
+				break;
+		}
+
+		return std::chrono::system_clock::from_time_t(tt);
+#else
+// Set the date using C++20 (or later) methods
+		const std::chrono::time_zone* zone = detail::currentZone();
+		std::chrono::local_seconds now = std::chrono::floor<std::chrono::seconds>(zone->to_local(after));
+		std::chrono::local_seconds next = std::chrono::floor<std::chrono::days>(now) + std::chrono::hours(m_Hours) + std::chrono::minutes(m_Minutes) + std::chrono::seconds(m_Seconds);
+
+		if (next <= now)
+			next += std::chrono::days(1);
+
+		return zone->to_sys(next, std::chrono::choose::earliest);
+#endif
+	}
+
+	// Change the current file (opening the new one and closing the current one), returning the next time it should be changed at
+	// (run by the shared scheduler at "changeTime", the time of day provided)
+	inline std::chrono::system_clock::time_point DailyLogger::changeFile(std::chrono::system_clock::time_point changeTime)
+	{
+		swapFile();
+		return nextChangeTime(changeTime);
+	}
+
+	// Open the file for the current time and replace the current one with it (the writers only wait for the swap, not for the file to be created)
+	inline void DailyLogger::swapFile()
+	{
+		std::string formattedFilePath(formatFilePath(m_FileNameFormat));
+		detail::FileSink nextSink;
+
+		// When the same file is recreated, write the messages buffered so far before emptying it, so they do not end up in the new file
+		if (m_FilePath == formattedFilePath)
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_FileSink.Flush();
+		}
+
+		// Keep writing to the current file if the new one cannot be opened
+		if (!nextSink.Open(formattedFilePath, true))
+			return;
+
+		std::string previousFilePath;
+		Compression compression;
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_FileSink.Swap(nextSink);
+			m_BinaryEncoder.Reset();
+#ifdef SBLOGGER_LEGACY
+			previousFilePath = m_FilePath;
+#else
+			previousFilePath = m_FilePath.string();
+#endif
+			m_FilePath = formattedFilePath;
+			compression = m_Compression;
+		}
+
+		// The previous file (now held by "nextSink") is written and closed after releasing the mutex
+		nextSink.Close();
+
+		// When the same file is recreated there is no previous file left to compress
+		if (compression != Compression::NONE && previousFilePath != formattedFilePath)
+			compressFile(previousFilePath, previousFilePath + detail::Compressor::GetExtension(compression), compression, nullptr);
+	}
+
+	//
+	// RotatingFileLogger class
+	//
+
+	// Used to log messages to a file stream, renamed to "<file>.1" (the previous ones being renamed to "<file>.2", "<file>.3" and so on) once it reaches
+	// the specified size. Previous files over the specified count or total size are deleted by the shared scheduler thread
+	class RotatingFileLogger : public FileLogger
+	{
+		//
+		// Private members
+		//
+
+		// Maximum size of the file used by default (10 MiB)
+		static const size_t DEFAULT_MAX_FILE_SIZE = 10u * 1024u * 1024u;
+
+		// Maximum number of previous files kept by default
+		static const size_t DEFAULT_MAX_FILES = 5u;
+
+		// Previous file, identified so that it can be found once compressed (even if renamed meanwhile)
+		struct RotatedFile
+		{
+			size_t size;
+			Compression compression;
+			size_t id;
+		};
+
+		size_t m_MaxFileSize, m_MaxFiles, m_MaxTotalSize;
+		size_t m_RotationSize;
+		std::deque<RotatedFile> m_RotatedFiles;
+		size_t m_RotatedSize;
+		size_t m_NoRotations;
+		size_t m_DeleteTask;
+
+		//
+		// Protected methods
+		//
+
+		// Rotates the file once it reaches the size it is rotated at (the mutex being held)
+		void afterWrite() override;
+
+		// Check and set the limits of the files, then find the files rotated before (deleting the ones over the limits)
+		void start(size_t maxFileSize, size_t maxFiles, size_t maxTotalSize);
+
+		// Get the path of the previous file "index" (1 being the latest), compressed using "compression"
+		std::string rotatedFilePath(size_t index, Compression compression = Compression::NONE) const;
+
+		// Renames the file to "<file>.1" (after renaming the previous ones) and opens a new one, then schedules deleting the files over the limits (the mutex
+		// must be held)
+		// If the new file cannot be opened, the files are renamed back and the rotation is only tried again once the file grows by another maximum size
+		void rotate();
+
+		// Forgets the oldest previous files while they are over the limits, scheduling deleting them if there are any (the mutex must be held)
+		void trimRotatedFiles();
+
+		// Deletes the previous files which are over the limits (run by the shared scheduler), the disk space being freed without holding the mutex
+		std::chrono::system_clock::time_point deleteRotatedFiles();
+
+		// Replaces the previous file "id" with its version compressed using "compression", "outputPath" (deleting it if the previous file was deleted meanwhile)
+		void rotatedFileCompressed(size_t id, const std::string& outputPath, Compression compression, size_t size);
+
+	public:
+		//
+		// Constructors and destructors
+		//
+
+		// Deleted to prevent usage without providing a file path
+		RotatingFileLogger() = delete;
+
+		// Creates an instance of RotatingFileLogger which outputs to a file stream given by the "filePath" parameter, which will be rotated once it reaches
+		// "maxFileSize" bytes, keeping at most "maxFiles" previous files and (if not 0) "maxTotalSize" bytes of them
+		// By default there is no formatting and auto flush is set to true
+		RotatingFileLogger(const char* filePath, const char* format = nullptr, size_t maxFileSize = DEFAULT_MAX_FILE_SIZE, size_t maxFiles = DEFAULT_MAX_FILES,
+			size_t maxTotalSize = 0u, bool autoFlush = true);
+
+		// Creates an instance of RotatingFileLogger which outputs to a file stream given by the "filePath" parameter, which will be rotated once it reaches
+		// "maxFileSize" bytes, keeping at most "maxFiles" previous files and (if not 0) "maxTotalSize" bytes of them
+		// By default there is no formatting and auto flush is set to true
+		RotatingFileLogger(const char* filePath, const std::string& format, size_t maxFileSize = DEFAULT_MAX_FILE_SIZE, size_t maxFiles = DEFAULT_MAX_FILES,
+			size_t maxTotalSize = 0u, bool autoFlush = true);
+
+		// Creates an instance of RotatingFileLogger which outputs to a file stream given by the "filePath" parameter, which will be rotated once it reaches
+		// "maxFileSize" bytes, keeping at most "maxFiles" previous files and (if not 0) "maxTotalSize" bytes of them
+		// By default there is no formatting and auto flush is set to true
+		RotatingFileLogger(const std::string& filePath, const std::string& format = std::string(), size_t maxFileSize = DEFAULT_MAX_FILE_SIZE,
+			size_t maxFiles = DEFAULT_MAX_FILES, size_t maxTotalSize = 0u, bool autoFlush = true);
+
+		// Copy constructor
+
+		RotatingFileLogger(const RotatingFileLogger& other) = delete;
+
+		// Move constructor
+
+		RotatingFileLogger(RotatingFileLogger&& other) = delete;
+
+		// Destructor
+
+		// Flush and close stream if open
+		~RotatingFileLogger() override;
+
+		//
+		// Overloaded operators
+		//
+
+		// Assignment operator (deleted since having two streams for the same file causes certain output not to be written).
+		RotatingFileLogger& operator=(const RotatingFileLogger& other) = delete;
+
+		//
+		// Public methods
+		//
+
+		// Rotate the file right away, regardless of its size
+		void Rotate();
+
+		// Get the size the file is rotated at
+		size_t GetMaxFileSize() const noexcept;
+
+		// Get the maximum number of previous files kept
+		size_t GetMaxFiles() const noexcept;
+
+		// Get the maximum total size of the previous files kept (0 for no limit)
+		size_t GetMaxTotalSize() const noexcept;
+	};
+
+	//
+	// Constructors and destructors
+	//
+
+	// Creates an instance of RotatingFileLogger which outputs to a file stream given by the "filePath" parameter, which will be rotated once it reaches
+	// "maxFileSize" bytes, keeping at most "maxFiles" previous files and (if not 0) "maxTotalSize" bytes of them
+	// By default there is no formatting and auto flush is set to true
+	inline RotatingFileLogger::RotatingFileLogger(const char* filePath, const char* format, size_t maxFileSize, size_t maxFiles, size_t maxTotalSize, bool autoFlush)
+		: FileLogger(filePath, format, autoFlush), m_MaxFileSize(0u), m_MaxFiles(0u), m_MaxTotalSize(0u), m_RotationSize(0u), m_RotatedFiles(), m_RotatedSize(0u), m_NoRotations(0u), m_DeleteTask(0u)
+	{
+		start(maxFileSize, maxFiles, maxTotalSize);
+	}
+
+	// Creates an instance of RotatingFileLogger which outputs to a file stream given by the "filePath" parameter, which will be rotated once it reaches
+	// "maxFileSize" bytes, keeping at most "maxFiles" previous files and (if not 0) "maxTotalSize" bytes of them
+	// By default there is no formatting and auto flush is set to true
+	inline RotatingFileLogger::RotatingFileLogger(const char* filePath, const std::string& format, size_t maxFileSize, size_t maxFiles, size_t maxTotalSize,
+		bool autoFlush)
+		: FileLogger(filePath, format, autoFlush), m_MaxFileSize(0u), m_MaxFiles(0u), m_MaxTotalSize(0u), m_RotationSize(0u), m_RotatedFiles(), m_RotatedSize(0u), m_NoRotations(0u), m_DeleteTask(0u)
+	{
+		start(maxFileSize, maxFiles, maxTotalSize);
+	}
+
+	// Creates an instance of RotatingFileLogger which outputs to a file stream given by the "filePath" parameter, which will be rotated once it reaches
+	// "maxFileSize" bytes, keeping at most "maxFiles" previous files and (if not 0) "maxTotalSize" bytes of them
+	// By default there is no formatting and auto flush is set to true
+	inline RotatingFileLogger::RotatingFileLogger(const std::string& filePath, const std::string& format, size_t maxFileSize, size_t maxFiles, size_t maxTotalSize,
+		bool autoFlush)
+		: FileLogger(filePath, format, autoFlush), m_MaxFileSize(0u), m_MaxFiles(0u), m_MaxTotalSize(0u), m_RotationSize(0u), m_RotatedFiles(), m_RotatedSize(0u), m_NoRotations(0u), m_DeleteTask(0u)
+	{
+		start(maxFileSize, maxFiles, maxTotalSize);
+	}
+
+	// Destructor
+
+	// Flush and close stream if open
+	inline RotatingFileLogger::~RotatingFileLogger()
+	{
+		size_t deleteTask;
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			deleteTask = m_DeleteTask;
+		}
+
+		// Waits for the files to be deleted or compressed if they are being deleted or compressed, thus without holding the mutex
+		detail::Scheduler::Get().Remove(deleteTask);
+		detail::Compressor::Get().Cancel(this);
+
+		// The previous files still waiting to be compressed are compressed in place instead, which no longer needs the logger as they cannot be renamed anymore
+		if (m_Compression == Compression::NONE)
+			return;
+		try
+		{
+			for (size_t index = 0u; index < m_RotatedFiles.size(); ++index)
+				if (m_RotatedFiles[index].compression == Compression::NONE)
+					compressFile(rotatedFilePath(index + 1u), rotatedFilePath(index + 1u, m_Compression), m_Compression, nullptr);
+		}
+		catch (...)
+		{ }
+	}
+
+	//
+	// Protected methods
+	//
+
+	// Rotates the file once it reaches the size it is rotated at (the mutex being held)
+	inline void RotatingFileLogger::afterWrite()
+	{
+		if (m_FileSink.GetSize() >= m_RotationSize)
+			rotate();
+	}
+
+	// Check and set the limits of the files, then find the files rotated before (deleting the ones over the limits)
+	inline void RotatingFileLogger::start(size_t maxFileSize, size_t maxFiles, size_t maxTotalSize)
+	{
+		if (maxFileSize == 0u) throw SizeRangeException();
+
+		m_MaxFileSize = maxFileSize;
+		m_RotationSize = maxFileSize;
+		m_MaxFiles = maxFiles;
+		m_MaxTotalSize = maxTotalSize;
+
+		// The sizes of the previous files are only read once, then counted by the logger
+		for (size_t index = 1u; ; ++index)
+		{
+			std::ifstream rotatedFile;
+			Compression compression = Compression::NONE;
+			for (Compression candidate : { Compression::NONE, Compression::LZ4, Compression::GZIP })
+			{
+				rotatedFile.open(rotatedFilePath(index, candidate), std::ios::binary | std::ios::ate);
+				if (rotatedFile.is_open())
+				{
+					compression = candidate;
+					break;
+				}
+			}
+			if (!rotatedFile.is_open())
+				break;
+
+			const std::streamoff size = rotatedFile.tellg();
+			m_RotatedFiles.push_back(RotatedFile{ size > 0 ? static_cast<size_t>(size) : 0u, compression, ++m_NoRotations });
+			m_RotatedSize += m_RotatedFiles.back().size;
+		}
 
-		return message;
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		trimRotatedFiles();
+		if (m_FileSink.GetSize() >= m_RotationSize)
+			rotate();
+	}
+
+	// Get the path of the previous file "index" (1 being the latest), compressed using "compression"
+	inline std::string RotatingFileLogger::rotatedFilePath(size_t index, Compression compression) const
+	{
+#ifdef SBLOGGER_LEGACY
+		return m_FilePath + '.' + std::to_string(index) + detail::Compressor::GetExtension(compression);
+#else
+		return m_FilePath.string() + '.' + std::to_string(index) + detail::Compressor::GetExtension(compression);
+#endif
 	}
 
-	// Replaces predefined placeholders from the message (e.g. "%er" will be changed to "Error" in the final message)
-	inline void Logger::replacePredefinedPlaceholders(std::string& message) const noexcept
+	// Renames the file to "<file>.1" (after renaming the previous ones) and opens a new one, then schedules deleting the files over the limits (the mutex
+	// must be held)
+	// If the new file cannot be opened, the files are renamed back and the rotation is only tried again once the file grows by another maximum size
+	inline void RotatingFileLogger::rotate()
 	{
 #ifdef SBLOGGER_LEGACY
-		std::string placeholder = "tr";
+		const std::string filePath(m_FilePath);
+#else
+		const std::string filePath(m_FilePath.string());
+#endif
+		detail::FileSink previousSink;
+
+		for (size_t index = m_RotatedFiles.size(); index > 0u; --index)
+		{
+			const Compression compression = m_RotatedFiles[index - 1u].compression;
+			std::rename(rotatedFilePath(index, compression).c_str(), rotatedFilePath(index + 1u, compression).c_str());
+		}
+
+		// The messages buffered for the file are written to it once "previousSink" is closed (before renaming it where open files cannot be renamed)
+		const size_t size = m_FileSink.GetSize();
+		previousSink.Swap(m_FileSink);
+#ifndef SBLOGGER_NIX
+		previousSink.Close();
+#endif
+		const bool renamed = std::rename(filePath.c_str(), rotatedFilePath(1u).c_str()) == 0;
+
+		// Keep writing to the previous file if the new one cannot be opened (e.g. no file descriptors or disk space left), with the files renamed back so
+		// that none of the previous files is deleted while the rotation keeps failing
+		if (!renamed || !m_FileSink.Open(filePath, true))
+		{
+			if (renamed)
+				std::rename(rotatedFilePath(1u).c_str(), filePath.c_str());
+#ifdef SBLOGGER_NIX
+			m_FileSink.Swap(previousSink);
+#else
+			m_FileSink.Open(filePath, false);
+#endif
+			for (size_t index = 1u; index <= m_RotatedFiles.size(); ++index)
+			{
+				const Compression compression = m_RotatedFiles[index - 1u].compression;
+				std::rename(rotatedFilePath(index + 1u, compression).c_str(), rotatedFilePath(index, compression).c_str());
+			}
+
+			m_RotationSize = size + m_MaxFileSize;
+			return;
+		}
+
+		m_BinaryEncoder.Reset();
+		m_RotationSize = m_MaxFileSize;
+		m_RotatedFiles.push_front(RotatedFile{ size, Compression::NONE, ++m_NoRotations });
+		m_RotatedSize += size;
+		trimRotatedFiles();
+
+		// Compressed to a file named after its identifier, as the previous file can be renamed meanwhile (its messages being written first)
+		previousSink.Close();
+		if (m_Compression != Compression::NONE && !m_RotatedFiles.empty())
+		{
+			const size_t id = m_NoRotations;
+			const Compression compression = m_Compression;
+			const std::string outputPath(filePath + ".compressing." + std::to_string(id) + detail::Compressor::GetExtension(compression));
+			compressFile(rotatedFilePath(1u), outputPath, compression, [this, id, outputPath, compression](bool compressed, size_t size)
+				{
+					if (compressed)
+						rotatedFileCompressed(id, outputPath, compression, size);
+				});
+		}
+	}
+
+	// Forgets the oldest previous files while they are over the limits, scheduling deleting them if there are any (the mutex must be held)
+	inline void RotatingFileLogger::trimRotatedFiles()
+	{
+		bool trimmed = false;
+
+		while (!m_RotatedFiles.empty() && (m_RotatedFiles.size() > m_MaxFiles || (m_MaxTotalSize > 0u && m_RotatedSize > m_MaxTotalSize)))
+		{
+			m_RotatedSize -= m_RotatedFiles.back().size;
+			m_RotatedFiles.pop_back();
+			trimmed = true;
+		}
+
+		if (!trimmed)
+			return;
+
+		if (m_DeleteTask == 0u)
+			m_DeleteTask = detail::Scheduler::Get().Add(std::chrono::system_clock::now(),
+				[this](std::chrono::system_clock::time_point) { return deleteRotatedFiles(); });
+		else
+			detail::Scheduler::Get().Reschedule(m_DeleteTask, std::chrono::system_clock::now());
+	}
+
+	// Deletes the previous files which are over the limits (run by the shared scheduler), the disk space being freed without holding the mutex
+	inline std::chrono::system_clock::time_point RotatingFileLogger::deleteRotatedFiles()
+	{
+#ifdef SBLOGGER_NIX
+		std::vector<int> descriptors;
+		{
+			// The files are unlinked while holding the mutex (so they are not renamed meanwhile), but kept open so that they are only freed once closed
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			for (size_t index = m_RotatedFiles.size() + 1u, noDeleted = 1u; noDeleted > 0u; ++index)
+			{
+				noDeleted = 0u;
+				for (Compression compression : { Compression::NONE, Compression::LZ4, Compression::GZIP })
+				{
+					const std::string filePath(rotatedFilePath(index, compression));
+					const int descriptor = ::open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+					if (descriptor < 0)
+						continue;
+
+					::unlink(filePath.c_str());
+					descriptors.push_back(descriptor);
+					++noDeleted;
+				}
+			}
+		}
+
+		for (int descriptor : descriptors)
+			::close(descriptor);
 #else
-		std::string_view placeholder = "tr";
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		for (size_t index = m_RotatedFiles.size() + 1u, noDeleted = 1u; noDeleted > 0u; ++index)
+		{
+			noDeleted = 0u;
+			for (Compression compression : { Compression::NONE, Compression::LZ4, Compression::GZIP })
+				if (std::remove(rotatedFilePath(index, compression).c_str()) == 0)
+					++noDeleted;
+		}
 #endif
-		size_t placeholderPosition;
-		while ((placeholderPosition = message.find(placeholder)) != std::string::npos && (message[placeholderPosition - 1u] == '%' || message[placeholderPosition - 2u] == '%'))
-			message[placeholderPosition - 1u] == '^' ? message.replace(placeholderPosition - 2u, placeholder.size() + 2u, "TRACE") : message.replace(placeholderPosition - 1u, placeholder.size() + 2u, "Trace");
 
-		while ((placeholderPosition = message.find(placeholder = "dbg")) != std::string::npos && (message[placeholderPosition - 1u] == '%' || message[placeholderPosition - 2u] == '%'))
-			message[placeholderPosition - 1u] == '^' ? message.replace(placeholderPosition - 2u, placeholder.size() + 2u, "DEBUG") : message.replace(placeholderPosition - 1u, placeholder.size() + 2u, "Debug");
+		return std::chrono::system_clock::time_point();
+	}
+
+	// Replaces the previous file "id" with its version compressed using "compression", "outputPath" (deleting it if the previous file was deleted meanwhile)
+	inline void RotatingFileLogger::rotatedFileCompressed(size_t id, const std::string& outputPath, Compression compression, size_t size)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		for (size_t index = 0u; index < m_RotatedFiles.size(); ++index)
+		{
+			RotatedFile& rotatedFile = m_RotatedFiles[index];
+			if (rotatedFile.id != id)
+				continue;
+
+			if (std::rename(outputPath.c_str(), rotatedFilePath(index + 1u, compression).c_str()) != 0)
+				break;
+
+			// The previous file is only freed once closed by the compressor, after releasing the mutex
+			std::remove(rotatedFilePath(index + 1u).c_str());
+			m_RotatedSize += size;
+			m_RotatedSize -= rotatedFile.size;
+			rotatedFile.size = size;
+			rotatedFile.compression = compression;
+			return;
+		}
+
+		std::remove(outputPath.c_str());
+	}
+
+	//
+	// Public methods
+	//
+
+	// Rotate the file right away, regardless of its size
+	inline void RotatingFileLogger::Rotate()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		rotate();
+	}
+
+	// Get the size the file is rotated at
+	inline size_t RotatingFileLogger::GetMaxFileSize() const noexcept
+	{
+		return m_MaxFileSize;
+	}
+
+	// Get the maximum number of previous files kept
+	inline size_t RotatingFileLogger::GetMaxFiles() const noexcept
+	{
+		return m_MaxFiles;
+	}
+
+	// Get the maximum total size of the previous files kept (0 for no limit)
+	inline size_t RotatingFileLogger::GetMaxTotalSize() const noexcept
+	{
+		return m_MaxTotalSize;
+	}
+
+	//
+	// AsyncLogger class
+	//
+
+	// Used to log messages through another logger, which writes them from a background thread
+	// (messages are formatted by the calling thread and handed to the writer through a bounded lock-free queue)
+	class AsyncLogger : public Logger
+	{
+		//
+		// Private members
+		//
+
+		// Maximum size of the messages written to the wrapped logger at once
+		static const size_t MAX_BATCH_SIZE = 64u * 1024u;
+
+		// Maximum number of messages written to the wrapped logger at once
+		static const size_t MAX_BATCH_MESSAGES = 4096u;
+
+		// Minimum age of a message (in nanoseconds) before it is merged from its thread queue by default, so that messages taken by other threads at an earlier time
+		// (but not yet queued) are written before it (read by value only, as it has no definition outside the class)
+		static const long long DEFAULT_MERGE_DELAY = 500000ll;
+
+		// Queued message, either formatted or a deferred record (formatted by the writer thread)
+		struct QueuedMessage
+		{
+			std::string data;
+			std::chrono::system_clock::time_point time;
+			LogLevel level;
+			bool isRecord;
+		};
+
+		// Queue of a single thread writing to the logger, along with the next message to be merged (only used by the writer thread)
+		struct StagingQueue
+		{
+			detail::BoundedQueue<QueuedMessage> queue;
+			QueuedMessage head;
+			bool hasHead;
+			std::atomic<bool> closed;
+
+			explicit StagingQueue(size_t capacity)
+				: queue(capacity), head(), hasHead(false), closed(false)
+			{ }
+		};
+
+		Logger& m_Logger;
+		const QueueMode m_QueueMode;
+		const size_t m_Capacity;
+		const unsigned long long m_Id;
+		detail::BoundedQueue<QueuedMessage> m_Queue;
+		std::vector<std::shared_ptr<StagingQueue>> m_StagingQueues;
+		std::vector<std::shared_ptr<StagingQueue>> m_DrainingQueues;
+		std::vector<StagingQueue*> m_MergeHeap;
+		size_t m_NoRetired;
+		std::mutex m_StagingMutex;
+		std::atomic<OverflowPolicy> m_OverflowPolicy;
+		std::atomic<LogLevel> m_DropLevel;
+		std::atomic<long long> m_MergeDelay;
+		std::atomic<size_t> m_NoDropped;
+		std::atomic<size_t> m_NoWritten;
+		std::atomic<bool> m_Stop;
+		std::atomic<bool> m_Sleeping;
+		std::atomic<size_t> m_NoFlushWaiting;
+		std::mutex m_Mutex;
+		std::condition_variable m_WakeUp;
+		std::condition_variable m_Drained;
+		std::thread m_Writer;
+
+		//
+		// Private methods
+		//
+
+		// Get a new unique logger id (never 0)
+		static unsigned long long nextId() noexcept;
+
+		// Get the queue of the calling thread, registering it the first time the thread writes to the logger
+		StagingQueue& stagingQueue();
+
+		// Wake the writer thread, if it is waiting for messages
+		void wakeWriter();
+
+		// Writes the queued messages to the wrapped logger, until the logger is destroyed
+		void writeMessages();
+
+		// Appends a queued message to "batch" (raising "batchLevel" to its level), or hands it right away to the wrapped logger if "forward" is true
+		// (for loggers encoding the deferred records themselves, e.g. a FileLogger in binary mode, which get them unformatted)
+		void batchMessage(std::string& batch, LogLevel& batchLevel, const QueuedMessage& message, bool forward);
+
+		// Appends the messages of all thread queues to "batch" in the order of their time (raising "batchLevel" to their highest level), returns the number of messages appended
+		// Unless "all" is true, messages newer than the merge delay are kept for the next call (messages are handed right away to the wrapped logger if "forward" is true)
+		size_t mergeStagingQueues(std::string& batch, LogLevel& batchLevel, bool all, bool forward);
+
+		// Check if any of the thread queues (or the messages taken from them) are waiting to be written
+		bool hasStagedMessages();
+
+		// Get the number of messages queued by all the threads since the logger was created
+		size_t stagedCount();
+
+		// Appends a message reporting the number of messages dropped since the last report
+		void appendDroppedMessage(std::string& output, size_t noDropped) const;
+
+		// Raises "batchLevel" to "logLevel", if higher (messages with no level, OFF, are ignored, being the initial level of a batch)
+		static void raiseLevel(LogLevel& batchLevel, LogLevel logLevel) noexcept;
+
+		// Queues a message (or a deferred record) written at "time", applying the overflow policy if the queue is full
+		void enqueue(LogLevel logLevel, const std::string& message, std::chrono::system_clock::time_point time, bool isRecord);
+
+	protected:
+		//
+		// Protected methods
+		//
+
+		// Appends the ANSII colour code if the wrapped logger supports them
+		void appendColour(std::string& output, size_t code, bool bright) const noexcept override;
+
+		// Queues the message to be written by the background thread (as if it had the highest log level)
+		void writeToStream(const std::string& message) override;
+
+		// Queues the message to be written by the background thread, applying the overflow policy if the queue is full
+		void dispatchMessage(LogLevel logLevel, const std::string& message, std::chrono::system_clock::time_point time) override;
+
+		// Queues the deferred record to be formatted and written by the background thread, applying the overflow policy if the queue is full
+		void dispatchRecord(LogLevel logLevel, const std::string& record, std::chrono::system_clock::time_point time) override;
+
+	public:
+		//
+		// Constructors and destructors
+		//
+
+		// Deleted to prevent usage without providing a logger to write to
+		AsyncLogger() = delete;
+
+		// Creates an instance of AsyncLogger which writes to "logger" (using its format and clock) from a background thread
+		// The queue holds at least "capacity" messages (8192 by default), waiting for a free slot when full (unless given a different "overflowPolicy")
+		// With QueueMode::PER_THREAD, each thread gets its own queue of "capacity" messages and the writer merges them by time
+		AsyncLogger(Logger& logger, size_t capacity = 8192u, OverflowPolicy overflowPolicy = OverflowPolicy::BLOCK, LogLevel dropLevel = LogLevel::ERROR,
+			QueueMode queueMode = QueueMode::SHARED);
+
+		// Copy constructor
+
+		AsyncLogger(const AsyncLogger& other) = delete;
+
+		// Move constructor
+
+		AsyncLogger(AsyncLogger&& other) = delete;
+
+		// Destructor
+
+		// Write the queued messages and stop the background thread
+		~AsyncLogger() override;
+
+		//
+		// Overloaded operators
+		//
+
+		// Assignment operator (deleted since only one writer thread should own the queue)
+		AsyncLogger& operator=(const AsyncLogger& other) = delete;
+
+		//
+		// Public methods
+		//
+
+		// Wait until all of the messages queued so far are written, then flush the wrapped logger
+		void Flush() noexcept override;
+
+		// Get the behaviour used when the queue is full
+		OverflowPolicy GetOverflowPolicy() const noexcept;
 
-		while ((placeholderPosition = message.find(placeholder = "inf")) != std::string::npos && (message[placeholderPosition - 1u] == '%' || message[placeholderPosition - 2u] == '%'))
-			message[placeholderPosition - 1u] == '^' ? message.replace(placeholderPosition - 2u, placeholder.size() + 2u, "INFO") : message.replace(placeholderPosition - 1u, placeholder.size() + 2u, "Info");
+		// Set the behaviour used when the queue is full (with DROP_BELOW_LEVEL, only messages below "dropLevel" are dropped, while the others wait)
+		void SetOverflowPolicy(OverflowPolicy overflowPolicy, LogLevel dropLevel = LogLevel::ERROR) noexcept;
 
-		while ((placeholderPosition = message.find(placeholder = "wn")) != std::string::npos && (message[placeholderPosition - 1u] == '%' || message[placeholderPosition - 2u] == '%'))
-			message[placeholderPosition - 1u] == '^' ? message.replace(placeholderPosition - 2u, placeholder.size() + 2u, "WARN") : message.replace(placeholderPosition - 1u, placeholder.size() + 2u, "Warn");
+		// Get the number of messages dropped (or overwritten) since the logger was created
+		size_t GetDroppedCount() const noexcept;
 
-		while ((placeholderPosition = message.find(placeholder = "er")) != std::string::npos && (message[placeholderPosition - 1u] == '%' || message[placeholderPosition - 2u] == '%'))
-			message[placeholderPosition - 1u] == '^' ? message.replace(placeholderPosition - 2u, placeholder.size() + 2u, "ERROR") : message.replace(placeholderPosition - 1u, placeholder.size() + 2u, "Error");
+		// Check if messages are formatted by the background thread
+		bool GetDeferredFormatting() const noexcept;
 
-		while ((placeholderPosition = message.find(placeholder = "crt")) != std::string::npos && (message[placeholderPosition - 1u] == '%' || message[placeholderPosition - 2u] == '%'))
-			message[placeholderPosition - 1u] == '^' ? message.replace(placeholderPosition - 2u, placeholder.size() + 2u, "CRITICAL") : message.replace(placeholderPosition - 1u, placeholder.size() + 2u, "Critical");
-	}
+		// Set if messages are formatted by the background thread, the calling thread only copying their arguments (numbers and strings)
+		// Messages with other arguments are still formatted by the calling thread
+		void SetDeferredFormatting(bool deferredFormatting) noexcept;
 
-	// Replace current logging level in format
-	inline void Logger::replaceCurrentLevel(std::string& message) const noexcept
-	{
-		const size_t placeholderPosition = message.find("lvl");
-		if (placeholderPosition != std::string::npos && (message[placeholderPosition - 1u] == '%' || message[placeholderPosition - 2u] == '%'))
-			switch (s_CurrentLogLevel)
-			{
-			case LogLevel::TRACE:
-				message[placeholderPosition - 1u] == '^' ?
-					message.replace(placeholderPosition - 2u, 5u, "TRACE") : message.replace(placeholderPosition - 2u, 4u, "Trace");
-				break;
-			case LogLevel::DEBUG:
-				message[placeholderPosition - 1u] == '^' ?
-					message.replace(placeholderPosition - 2u, 5u, "DEBUG") : message.replace(placeholderPosition - 2u, 4u, "Debug");
-				break;
-			case LogLevel::INFO:
-				message[placeholderPosition - 1u] == '^' ?
-					message.replace(placeholderPosition - 2u, 5u, "INFO") : message.replace(placeholderPosition - 2u, 4u, "Info");
-				break;
-			case LogLevel::WARN:
-				message[placeholderPosition - 1u] == '^' ?
-					message.replace(placeholderPosition - 2u, 5u, "WARN") : message.replace(placeholderPosition - 2u, 4u, "Warn");
-				break;
-			case LogLevel::ERROR:
-				message[placeholderPosition - 1u] == '^' ?
-					message.replace(placeholderPosition - 2u, 5u, "ERROR") : message.replace(placeholderPosition - 2u, 4u, "Error");
-				break;
-			case LogLevel::CRITICAL:
-				message[placeholderPosition - 1u] == '^' ?
-					message.replace(placeholderPosition - 2u, 5u, "CRITICAL") : message.replace(placeholderPosition - 2u, 4u, "Critical");
-				break;
-			default:
-				message = "";
-				break;
-			}
-	}
+		// Get the queues used by the logger
+		QueueMode GetQueueMode() const noexcept;
 
-	// Replace other placeholders, such as those for file, line and function related information
-	inline void Logger::replaceOthers(std::string& message, const char* file, const char* line, const char* function) const noexcept
-	{
-#ifdef SBLOGGER_LEGACY
-		std::string placeholder = "src";
-#else
-		std::string_view placeholder = "src";
-#endif
-		size_t placeholderPosition = message.find(placeholder);
-		char* fileShortName;
-		while (placeholderPosition != std::string::npos && message[placeholderPosition - 1u] == '%')
-			message.replace(placeholderPosition - 1u, 4u, file == nullptr ? "" : 
-				((fileShortName = (char*)std::strrchr(file, SBLOGGER_PATH_SEPARATOR)) ? (fileShortName + 1) : ""));
+		// Get how long messages are kept in their thread queue before being merged (for PER_THREAD queues)
+		std::chrono::nanoseconds GetMergeDelay() const noexcept;
 
-		placeholder = "fsrc";
-		while ((placeholderPosition = message.find(placeholder)) != std::string::npos && message[placeholderPosition - 1u] == '%')
-			message.replace(placeholderPosition - 1u, 5u, file == nullptr ? "" : file);
+		// Set how long messages are kept in their thread queue before being merged (for PER_THREAD queues, half a millisecond by default)
+		// Messages are only ordered if queued within that delay of their time, so messages of threads delayed for longer (e.g. preempted) can follow newer ones
+		void SetMergeDelay(std::chrono::nanoseconds mergeDelay) noexcept;
+	};
 
-		placeholder = "ln";
-		while ((placeholderPosition = message.find(placeholder)) != std::string::npos && message[placeholderPosition - 1u] == '%')
-			message.replace(placeholderPosition - 1u, 3u, line == nullptr ? "" : line);
+	//
+	// Constructors and destructors
+	//
 
-		placeholder = "func";
-		while ((placeholderPosition = message.find(placeholder)) != std::string::npos && message[placeholderPosition - 1u] == '%')
-			message.replace(placeholderPosition - 1u, 5u, function == nullptr ? "" : function);
+	// Creates an instance of AsyncLogger which writes to "logger" (using its format and clock) from a background thread
+	// The queue holds at least "capacity" messages (8192 by default), waiting for a free slot when full (unless given a different "overflowPolicy")
+	// With QueueMode::PER_THREAD, each thread gets its own queue of "capacity" messages and the writer merges them by time
+	inline AsyncLogger::AsyncLogger(Logger& logger, size_t capacity, OverflowPolicy overflowPolicy, LogLevel dropLevel, QueueMode queueMode)
+		: Logger(logger.GetFormat(), false), m_Logger(logger), m_QueueMode(queueMode), m_Capacity(capacity), m_Id(nextId()),
+		m_Queue(queueMode == QueueMode::PER_THREAD ? 1u : capacity), m_StagingQueues(), m_DrainingQueues(), m_MergeHeap(), m_NoRetired(0u),
+		m_OverflowPolicy(overflowPolicy), m_DropLevel(dropLevel), m_MergeDelay(DEFAULT_MERGE_DELAY), m_NoDropped(0u), m_NoWritten(0u), m_Stop(false), m_Sleeping(false), m_NoFlushWaiting(0u)
+	{
+		SetClock(logger.GetClock());
+		m_Writer = std::thread(&AsyncLogger::writeMessages, this);
 	}
 
-	// Replace date format using std::strftime (pre C++20) or std::chrono::format
-	inline void Logger::replaceDateFormats(std::string& message) const noexcept
+	// Destructor
+
+	// Write the queued messages and stop the background thread
+	inline AsyncLogger::~AsyncLogger()
 	{
-// Replace date format using std::strftime (pre C++20)
-#ifdef SBLOGGER_OLD_DATES
-		std::time_t currentTime = std::time(nullptr);
-		size_t messageLength = message.size();
-		char* buffer = new char[messageLength + 101u]{ 0 };
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Stop.store(true);
+		}
+		m_WakeUp.notify_one();
 
-		if (std::strftime(buffer, sizeof(char) * (messageLength + 100u), message.c_str(), std::localtime(&currentTime)))
-			message = std::string(buffer);
+		if (m_Writer.joinable())
+			m_Writer.join();
+		m_Logger.Flush();
 
-		delete[] buffer;
-// Replace date format using std::chrono::format
-#else
-		// Replace date format using std::chrono::format
-		// Wait for MSVC to catch up
-#endif
+		// Let the threads still holding a queue of this logger release it when they next register one
+		std::lock_guard<std::mutex> lock(m_StagingMutex);
+		for (const std::shared_ptr<StagingQueue>& queue : m_StagingQueues)
+			queue->closed.store(true, std::memory_order_relaxed);
 	}
 
 	//
-	// Public methods
+	// Private methods
 	//
 
-	// Indent (prepend '\t') log, returns the number of indents the final message will contain
-	inline size_t Logger::Indent() noexcept
+	// Get a new unique logger id (never 0)
+	inline unsigned long long AsyncLogger::nextId() noexcept
 	{
-		return ++m_IndentCount;
+		static std::atomic<unsigned long long> lastId(0u);
+		return ++lastId;
 	}
 
-	// Dedent (prepend '\t') log, returns the number of indents the final message will contain
-	inline size_t Logger::Dedent() noexcept
+	// Get the queue of the calling thread, registering it the first time the thread writes to the logger
+	inline AsyncLogger::StagingQueue& AsyncLogger::stagingQueue()
 	{
-		return m_IndentCount > 0 ? --m_IndentCount : m_IndentCount;
+		typedef std::pair<unsigned long long, std::shared_ptr<StagingQueue>> Registration;
+		thread_local std::vector<Registration> registrations;
+
+		for (const Registration& registration : registrations)
+			if (registration.first == m_Id)
+				return *registration.second;
+
+		// Release the queues of the loggers destroyed since, then register a new one with the writer thread
+		registrations.erase(std::remove_if(registrations.begin(), registrations.end(),
+			[](const Registration& registration) { return registration.second->closed.load(std::memory_order_relaxed); }), registrations.end());
+
+		std::shared_ptr<StagingQueue> queue = std::make_shared<StagingQueue>(m_Capacity);
+		{
+			std::lock_guard<std::mutex> lock(m_StagingMutex);
+			m_StagingQueues.push_back(queue);
+		}
+		registrations.push_back(Registration(m_Id, queue));
+
+		return *queue;
 	}
 
-	// Set the current logging level to one of the "LOG_LEVELS" options (ex.: TRACE, DEBUG, INFO etc).
-	inline void Logger::SetLoggingLevel(const LogLevel& level) noexcept
+	// Wake the writer thread, if it is waiting for messages
+	inline void AsyncLogger::wakeWriter()
 	{
-		s_CurrentLogLevel = level;
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (m_Sleeping.load(std::memory_order_relaxed))
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_WakeUp.notify_one();
+		}
 	}
 
-	// Get the current logging level (one of the "LOG_LEVELS" options, ex.: TRACE, DEBUG, INFO etc). 
-	inline LogLevel Logger::GetLoggingLevel() noexcept
+	// Appends a message reporting the number of messages dropped since the last report
+	inline void AsyncLogger::appendDroppedMessage(std::string& output, size_t noDropped) const
 	{
-		return s_CurrentLogLevel;
+		static const char text[] = "{0} messages dropped";
+		const detail::FormatArgument arguments[]{ detail::makeArgument(noDropped) };
+
+		replacePlaceholders(output, LogLevel::WARN, { text, sizeof(text) - 1u, nullptr, 0u, nullptr, 0u, false }, arguments, 1u, nullptr, messageTime(), messageElapsed());
+		output.push_back('\n');
 	}
 
-	// Get the current log format
-	inline std::string Logger::GetFormat() const noexcept
+	// Raises "batchLevel" to "logLevel", if higher (messages with no level, OFF, are ignored, being the initial level of a batch)
+	inline void AsyncLogger::raiseLevel(LogLevel& batchLevel, LogLevel logLevel) noexcept
 	{
-		return m_Format;
+		if (logLevel != LogLevel::OFF && (batchLevel == LogLevel::OFF || logLevel > batchLevel))
+			batchLevel = logLevel;
 	}
 
-	// Set the current log format to "format"
-	inline void Logger::SetFormat(const std::string& format)
+	// Appends a queued message to "batch" (raising "batchLevel" to its level), or hands it right away to the wrapped logger if "forward" is true
+	// (for loggers encoding the deferred records themselves, e.g. a FileLogger in binary mode, which get them unformatted)
+	inline void AsyncLogger::batchMessage(std::string& batch, LogLevel& batchLevel, const QueuedMessage& message, bool forward)
 	{
-		m_Format = format;
+		if (forward)
+		{
+			try
+			{
+				if (message.isRecord)
+					dispatchRecordOf(m_Logger, message.level, message.data, message.time);
+				else
+					dispatchMessageOf(m_Logger, message.level, message.data, message.time);
+			}
+			catch (...)
+			{ }
+			return;
+		}
+
+		if (message.isRecord)
+			formatRecord(batch, message.data);
+		else
+			batch.append(message.data);
+		raiseLevel(batchLevel, message.level);
 	}
 
-	// Writes to the stream the newline character with a log level of TRACE
-	inline void Logger::WriteLine(LogLevel logLevel)
+	// Writes the queued messages to the wrapped logger, until the logger is destroyed
+	inline void AsyncLogger::writeMessages()
 	{
-		if(s_CurrentLogLevel <= logLevel)
-			writeToStream("\n");
+		std::string batch;
+		LogLevel batchLevel;
+		size_t noMessages, noDropped, noReported = 0u;
+		bool stop, forward;
+
+		for (;;)
+		{
+			stop = m_Stop.load(std::memory_order_acquire);
+			forward = encodesRecordsOf(m_Logger);
+			noMessages = 0u;
+			batch.clear();
+			batchLevel = LogLevel::OFF;
+			if (m_QueueMode == QueueMode::PER_THREAD)
+				noMessages = mergeStagingQueues(batch, batchLevel, stop, forward);
+			else
+				while (batch.size() < MAX_BATCH_SIZE && noMessages < MAX_BATCH_MESSAGES && m_Queue.TryPop([this, &batch, &batchLevel, forward](QueuedMessage& message)
+					{
+						batchMessage(batch, batchLevel, message, forward);
+					}))
+					++noMessages;
+
+			// The drops are reported after the messages already taken from the queue, which were queued before them
+			if ((noDropped = m_NoDropped.load(std::memory_order_relaxed)) != noReported)
+			{
+				appendDroppedMessage(batch, noDropped - noReported);
+				raiseLevel(batchLevel, LogLevel::WARN);
+				noReported = noDropped;
+			}
+
+			if (!batch.empty() || noMessages > 0u)
+			{
+				try
+				{
+					// The wrapped logger gets the highest level of the batch (e.g. so that a FileLogger flushes it if it contains an error)
+					if (!batch.empty())
+						dispatchMessageOf(m_Logger, batchLevel, batch);
+				}
+				catch (...)
+				{ }
+				m_NoWritten.fetch_add(noMessages);
+
+				if (m_NoFlushWaiting.load() > 0u)
+				{
+					std::lock_guard<std::mutex> lock(m_Mutex);
+					m_Drained.notify_all();
+				}
+				continue;
+			}
+			if (stop)
+				break;
+
+			// Nothing to write, wait for the producers (the timeout only guards against a missed notification)
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_Sleeping.store(true, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (m_Queue.Empty() && !m_Stop.load(std::memory_order_relaxed))
+			{
+				// Messages kept back by the merge are written once they are old enough
+				if (m_QueueMode == QueueMode::PER_THREAD && hasStagedMessages())
+					m_WakeUp.wait_for(lock, std::chrono::nanoseconds(m_MergeDelay.load(std::memory_order_relaxed)));
+				else
+					m_WakeUp.wait_for(lock, std::chrono::milliseconds(100));
+			}
+			m_Sleeping.store(false, std::memory_order_relaxed);
+		}
 	}
 
-	//
-	// Generic write methods to write a TRACE level message to the stream
-	//
+	// Appends the messages of all thread queues to "batch" in the order of their time (raising "batchLevel" to their highest level), returns the number of messages appended
+	// Unless "all" is true, messages newer than the merge delay are kept for the next call (messages are handed right away to the wrapped logger if "forward" is true)
+	inline size_t AsyncLogger::mergeStagingQueues(std::string& batch, LogLevel& batchLevel, bool all, bool forward)
+	{
+		const std::chrono::system_clock::time_point now = detail::Clock::Now(m_Clock), cutOff = now - std::chrono::nanoseconds(m_MergeDelay.load(std::memory_order_relaxed));
+		const auto later = [](const StagingQueue* first, const StagingQueue* second) { return first->head.time > second->head.time; };
+		const auto takeHead = [](StagingQueue& queue)
+		{
+			return queue.hasHead = queue.queue.TryPop([&queue](QueuedMessage& message) { std::swap(queue.head, message); });
+		};
+		size_t noMessages = 0u;
 
-	// Writes to the stream a message and inserts values into placeholders (should they exist) with a default level of TRACE
-	template<typename ...T>
-	inline void Logger::Write(const std::string& message, const T& ...t)
+		// Take a snapshot of the registered queues, retiring the ones whose thread has exited and which were fully written
+		m_DrainingQueues.clear();
+		{
+			std::lock_guard<std::mutex> lock(m_StagingMutex);
+			for (size_t i = 0u; i < m_StagingQueues.size(); )
+			{
+				StagingQueue& queue = *m_StagingQueues[i];
+
+				if (m_StagingQueues[i].use_count() == 1)
+				{
+					std::atomic_thread_fence(std::memory_order_acquire);
+					if (!queue.hasHead && queue.queue.Empty())
+					{
+						m_NoRetired += queue.queue.PushCount();
+						m_StagingQueues[i] = m_StagingQueues.back();
+						m_StagingQueues.pop_back();
+						continue;
+					}
+				}
+				++i;
+			}
+			m_DrainingQueues = m_StagingQueues;
+		}
+
+		// Merge the oldest message of each queue, until the batch is full or they are all empty
+		m_MergeHeap.clear();
+		for (const std::shared_ptr<StagingQueue>& queue : m_DrainingQueues)
+			if (queue->hasHead || takeHead(*queue))
+				m_MergeHeap.push_back(queue.get());
+		std::make_heap(m_MergeHeap.begin(), m_MergeHeap.end(), later);
+
+		while (!m_MergeHeap.empty() && batch.size() < MAX_BATCH_SIZE && noMessages < MAX_BATCH_MESSAGES)
+		{
+			// Keep the oldest message back while it is recent (unless the clock was moved back since it was taken)
+			const std::chrono::system_clock::time_point time = m_MergeHeap.front()->head.time;
+			if (!all && time > cutOff && time <= now + std::chrono::seconds(1))
+				break;
+
+			std::pop_heap(m_MergeHeap.begin(), m_MergeHeap.end(), later);
+			StagingQueue& queue = *m_MergeHeap.back();
+
+			batchMessage(batch, batchLevel, queue.head, forward);
+			++noMessages;
+
+			if (takeHead(queue))
+				std::push_heap(m_MergeHeap.begin(), m_MergeHeap.end(), later);
+			else
+				m_MergeHeap.pop_back();
+		}
+
+		return noMessages;
+	}
+
+	// Check if any of the thread queues (or the messages taken from them) are waiting to be written
+	inline bool AsyncLogger::hasStagedMessages()
 	{
-		if (s_CurrentLogLevel <= LogLevel::TRACE)
-			writeToStream(replacePlaceholders(message, std::vector<std::string>{ stringConvert(t)... }));
+		std::lock_guard<std::mutex> lock(m_StagingMutex);
+
+		for (const std::shared_ptr<StagingQueue>& queue : m_StagingQueues)
+			if (queue->hasHead || !queue->queue.Empty())
+				return true;
+
+		return false;
 	}
 
-	// Writes to the stream a message and inserts values into placeholders (should they exist) and finishes with the newline character with a default level of TRACE
-	template<typename ...T>
-	inline void Logger::WriteLine(const std::string& message, const T& ...t)
+	// Get the number of messages queued by all the threads since the logger was created
+	inline size_t AsyncLogger::stagedCount()
 	{
-		if (s_CurrentLogLevel <= LogLevel::TRACE)
-			writeToStream(replacePlaceholders(message, std::vector<std::string>{ stringConvert(t)... }) + "\n");
+		std::lock_guard<std::mutex> lock(m_StagingMutex);
+		size_t noQueued = m_NoRetired;
+
+		for (const std::shared_ptr<StagingQueue>& queue : m_StagingQueues)
+			noQueued += queue->queue.PushCount();
+
+		return noQueued;
 	}
 
 	//
-	// Generic Methods: Write a level message (depending on the specified "LOG_LEVEL") to a stream 
+	// Protected methods
 	//
 
-	// Writes to the stream a message and inserts values into placeholders (should they exist), with "logLevel" importance
-	template<typename ...T>
-	inline void Logger::Write(LogLevel logLevel, const std::string& message, const T& ...t)
+	// Appends the ANSII colour code if the wrapped logger supports them
+	inline void AsyncLogger::appendColour(std::string& output, size_t code, bool bright) const noexcept
 	{
-		if (s_CurrentLogLevel <= logLevel)
-			writeToStream(replacePlaceholders(message, std::vector<std::string>{ stringConvert(t)... }));
+		appendColourOf(m_Logger, output, code, bright);
 	}
 
-	// Writes to the stream a message and inserts values into placeholders (should they exist) and finishes with the newline character, with "logLevel" importance
-	template<typename ...T>
-	inline void Logger::WriteLine(LogLevel logLevel, const std::string& message, const T& ...t)
+	// Queues the message to be written by the background thread (as if it had the highest log level)
+	inline void AsyncLogger::writeToStream(const std::string& message)
 	{
-		if (s_CurrentLogLevel <= logLevel)
-			writeToStream(replacePlaceholders(message, std::vector<std::string>{ stringConvert(t)... }) + "\n");
+		dispatchMessage(LogLevel::OFF, message, std::chrono::system_clock::time_point());
 	}
 
-	//
-	// Generic Methods: Write a TRACE level message to a stream 
-	//
+	// Queues the message to be written by the background thread, applying the overflow policy if the queue is full
+	inline void AsyncLogger::dispatchMessage(LogLevel logLevel, const std::string& message, std::chrono::system_clock::time_point time)
+	{
+		enqueue(logLevel, message, time, false);
+	}
 
-	// Writes to the stream a message and inserts values into placeholders (should they exist), of TRACE importance
-	template<typename ...T>
-	inline void Logger::Trace(const std::string& message, const T& ...t)
+	// Queues the deferred record to be formatted and written by the background thread, applying the overflow policy if the queue is full
+	inline void AsyncLogger::dispatchRecord(LogLevel logLevel, const std::string& record, std::chrono::system_clock::time_point time)
+	{
+		enqueue(logLevel, record, time, true);
+	}
+
+	// Queues a message (or a deferred record) written at "time", applying the overflow policy if the queue is full
+	inline void AsyncLogger::enqueue(LogLevel logLevel, const std::string& message, std::chrono::system_clock::time_point time, bool isRecord)
 	{
-		if (s_CurrentLogLevel <= LogLevel::TRACE)
-			writeToStream(replacePlaceholders(message, std::vector<std::string>{ stringConvert(t)... }));
+		detail::BoundedQueue<QueuedMessage>& queue = m_QueueMode == QueueMode::PER_THREAD ? stagingQueue().queue : m_Queue;
+
+		// Messages whose format has no time are merged by the time they were queued at
+		if (m_QueueMode == QueueMode::PER_THREAD && time == std::chrono::system_clock::time_point())
+			time = detail::Clock::Now(m_Clock);
+
+		while (!queue.TryPush([&message, time, logLevel, isRecord](QueuedMessage& slot)
+			{
+				slot.data.assign(message);
+				slot.time = time;
+				slot.level = logLevel;
+				slot.isRecord = isRecord;
+			}))
+		{
+			switch (m_OverflowPolicy.load(std::memory_order_relaxed))
+			{
+			case OverflowPolicy::DROP_NEWEST:
+				m_NoDropped.fetch_add(1u, std::memory_order_relaxed);
+				wakeWriter();
+				return;
+			case OverflowPolicy::DROP_BELOW_LEVEL:
+				if (logLevel < m_DropLevel.load(std::memory_order_relaxed))
+				{
+					m_NoDropped.fetch_add(1u, std::memory_order_relaxed);
+					wakeWriter();
+					return;
+				}
+				break;
+			case OverflowPolicy::OVERWRITE_OLDEST:
+				// Take the place of the oldest message (counted as written, so that Flush does not wait for it)
+				if (queue.TryPop([](QueuedMessage&) { }))
+				{
+					m_NoDropped.fetch_add(1u, std::memory_order_relaxed);
+					m_NoWritten.fetch_add(1u);
+					continue;
+				}
+				break;
+			default:
+				break;
+			}
+
+			wakeWriter();
+			std::this_thread::yield();
+		}
+		wakeWriter();
 	}
 
 	//
-	// Generic Methods: Write a DEBUG level message to a stream 
+	// Public methods
 	//
 
-	// Writes to the stream a message and inserts values into placeholders (should they exist), of DEBUG importance
-	template<typename ...T>
-	inline void Logger::Debug(const std::string& message, const T& ...t)
+	// Wait until all of the messages queued so far are written, then flush the wrapped logger
+	inline void AsyncLogger::Flush() noexcept
 	{
-		if (s_CurrentLogLevel <= LogLevel::DEBUG)
-			writeToStream(replacePlaceholders(message, std::vector<std::string>{ stringConvert(t)... }));
+		size_t noQueued = m_QueueMode == QueueMode::PER_THREAD ? stagedCount() : m_Queue.PushCount();
+
+		m_NoFlushWaiting.fetch_add(1u);
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_WakeUp.notify_one();
+			m_Drained.wait(lock, [this, noQueued]() { return m_NoWritten.load() >= noQueued; });
+		}
+		m_NoFlushWaiting.fetch_sub(1u);
+
+		m_Logger.Flush();
 	}
 
-	//
-	// Generic Methods: Write a INFO level message to a stream 
-	//
+	// Get the behaviour used when the queue is full
+	inline OverflowPolicy AsyncLogger::GetOverflowPolicy() const noexcept
+	{
+		return m_OverflowPolicy.load(std::memory_order_relaxed);
+	}
 
-	// Writes to the stream a message and inserts values into placeholders (should they exist), of INFO importance
-	template<typename ...T>
-	inline void Logger::Info(const std::string& message, const T& ...t)
+	// Set the behaviour used when the queue is full (with DROP_BELOW_LEVEL, only messages below "dropLevel" are dropped, while the others wait)
+	inline void AsyncLogger::SetOverflowPolicy(OverflowPolicy overflowPolicy, LogLevel dropLevel) noexcept
 	{
-		if (s_CurrentLogLevel <= LogLevel::INFO)
-			writeToStream(replacePlaceholders(message, std::vector<std::string>{ stringConvert(t)... }));
+		m_DropLevel.store(dropLevel, std::memory_order_relaxed);
+		m_OverflowPolicy.store(overflowPolicy, std::memory_order_relaxed);
 	}
 
-	//
-	// Generic Methods: Write a WARN level message to a stream 
-	//
+	// Get the number of messages dropped (or overwritten) since the logger was created
+	inline size_t AsyncLogger::GetDroppedCount() const noexcept
+	{
+		return m_NoDropped.load(std::memory_order_relaxed);
+	}
 
-	// Writes to the stream a message and inserts values into placeholders (should they exist), of WARN importance
-	template<typename ...T>
-	inline void Logger::Warn(const std::string& message, const T& ...t)
+	// Check if messages are formatted by the background thread
+	inline bool AsyncLogger::GetDeferredFormatting() const noexcept
 	{
-		if (s_CurrentLogLevel <= LogLevel::WARN)
-			writeToStream(replacePlaceholders(message, std::vector<std::string>{ stringConvert(t)... }));
+		return m_DeferFormatting.load(std::memory_order_relaxed);
 	}
 
-	//
-	// Generic Methods: Write a ERROR level message to a stream 
-	//
+	// Set if messages are formatted by the background thread, the calling thread only copying their arguments (numbers and strings)
+	// Messages with other arguments are still formatted by the calling thread
+	inline void AsyncLogger::SetDeferredFormatting(bool deferredFormatting) noexcept
+	{
+		m_DeferFormatting.store(deferredFormatting, std::memory_order_relaxed);
+	}
 
-	// Writes to the stream a message and inserts values into placeholders (should they exist), of ERROR importance
-	template<typename ...T>
-	inline void Logger::Error(const std::string& message, const T& ...t)
+	// Get the queues used by the logger
+	inline QueueMode AsyncLogger::GetQueueMode() const noexcept
 	{
-		if (s_CurrentLogLevel <= LogLevel::ERROR)
-			writeToStream(replacePlaceholders(message, std::vector<std::string>{ stringConvert(t)... }));
+		return m_QueueMode;
 	}
 
-	//
-	// Generic Methods: Write a CRITICAL level message to a stream 
-	//
+	// Get how long messages are kept in their thread queue before being merged (for PER_THREAD queues)
+	inline std::chrono::nanoseconds AsyncLogger::GetMergeDelay() const noexcept
+	{
+		return std::chrono::nanoseconds(m_MergeDelay.load(std::memory_order_relaxed));
+	}
 
-	// Writes to the stream a message and inserts values into placeholders (should they exist), of CRITICAL importance
-	template<typename ...T>
-	inline void Logger::Critical(const std::string& message, const T& ...t)
+	// Set how long messages are kept in their thread queue before being merged (for PER_THREAD queues, half a millisecond by default)
+	// Messages are only ordered if queued within that delay of their time, so messages of threads delayed for longer (e.g. preempted) can follow newer ones
+	inline void AsyncLogger::SetMergeDelay(std::chrono::nanoseconds mergeDelay) noexcept
 	{
-		if (s_CurrentLogLevel <= LogLevel::CRITICAL)
-			writeToStream(replacePlaceholders(message, std::vector<std::string>{ stringConvert(t)... }));
+		m_MergeDelay.store(mergeDelay.count() > 0 ? static_cast<long long>(mergeDelay.count()) : 0ll, std::memory_order_relaxed);
 	}
 
 	//
-	// StreamLogger class
+	// BinaryLogReader class
 	//
 
-	// Used to log messages to a non-file stream (ex.: STDOUT, STDERR, STDLOG)
-	class StreamLogger : public Logger
+	// Used to read the files written by FileLoggers in binary mode, formatting their messages as text with the format they were written with (or a given one)
+	// Messages are read one at a time (using "Next"), so that they can be filtered by level or time before being formatted
+	class BinaryLogReader : protected Logger
 	{
-	protected:
 		//
-		// Protected members
+		// Private members
 		//
 
-		StreamType m_StreamType;
+		// Static parts of a message, read from the dictionary of the file
+		struct Message
+		{
+			std::string text;
+			std::string file;
+			std::string fileName;
+			std::string function;
+			unsigned int line;
+			size_t indent;
+			LogLevel level;
+			unsigned char noArguments;
+			unsigned char flags;
+		};
+
+		// Maximum size of a string read from a file (larger sizes meaning that it is corrupted)
+		static const unsigned long long MAX_STRING_SIZE = 1ull << 32u;
+
+		// Value of "m_Current" when the last message read was already formatted
+		static const size_t NO_MESSAGE = static_cast<size_t>(-1);
+
+		std::istream& m_Input;
+		std::string m_SessionFormat;
+		bool m_KeepFormat;
+		bool m_Started;
+		bool m_Truncated;
+		std::vector<Message> m_Messages;
+		long long m_Time;
+		long long m_ElapsedOrigin;
+		size_t m_Current;
+		LogLevel m_Level;
+		std::string m_Text;
+		std::string m_Arguments;
 
 		//
-		// Protected methods
+		// Private methods
 		//
 
-#if defined SBLOGGER_COLOURS || defined SBLOGGER_COLORS
-		// Adds colours where the specific placeholders are found (e.g. %colour_name{...}colour_name%)
-		void addColours(std::string& message) const noexcept override;
-#endif	// Adds colours where the specific placeholders are found (e.g. %colour_name{...}colour_name%)
+		// Reads "size" bytes into "data", returns false if the input ended first
+		bool readBytes(void* data, size_t size);
 
-		// Writes string to appropriate stream based on instance STREAM_TYPE (m_StreamType)
-		void writeToStream(const std::string& str) override;
+		// Reads a number written using 7 bits per byte, returns false if the input ended first
+		bool readVarint(unsigned long long& value);
 
-	public:
+		// Reads a signed number written using 7 bits per byte (interleaving positive and negative values), returns false if the input ended first
+		bool readSignedVarint(long long& value);
+
+		// Appends the bytes of "value" to the arguments of the current record
+		template<typename T>
+		void appendArgument(const T& value);
+
+		// Reads a string (its size followed by its characters), returns false if the input ended first
+		bool readString(std::string& value);
+
+		// Reads the time of an entry, written as the difference from the time of the previous one, returns false if the input ended first
+		bool readTime();
+
+		// Reads the start of a session, checking that it can be read on this system, returns false if the input ended first
+		bool readSession();
+
+		// Reads a message of the dictionary, returns false if the input ended first
+		bool readMessage();
+
+		// Reads a record of the message "id", returns false if the input ended first
+		bool readRecord(unsigned long long id);
+
+		// Reads an already formatted message, returns false if the input ended first
+		bool readText();
+
+	protected:
 		//
-		// Constructors and destructors
+		// Protected methods
 		//
 
-		// Creates an instance of Logger which outputs to a stream chosen from a STREAM_TYPE
-		// By default uses STREAM_TYPE::STDOUT and no format or auto flush
-		StreamLogger(const StreamType& type = StreamType::STDOUT, const std::string& format = std::string(), bool autoFlush = false);
+		// Not used, the reader only formats the messages
+		void writeToStream(const std::string& message) override;
 
-		// Creates an instance of Logger which outputs to STDOUT. Formats logs and auto flushes based on the parameter "autoFlush"
-		StreamLogger(const std::string& format, bool autoFlush = false);
+	public:
+		//
+		// Constructors and destructors
+		//
 
-		// Creates an instance of Logger which outputs to STDOUT. Formats logs and auto flushes based on the parameter "autoFlush"
-		StreamLogger(const char* format, bool autoFlush = false);
+		// Deleted to prevent usage without providing an input
+		BinaryLogReader() = delete;
 
-		// Creates an instance of Logger which outputs to STDOUT. Formats logs and auto flushes based on the parameter "autoFlush"
-		StreamLogger(bool autoFlush) noexcept;
+		// Creates an instance of BinaryLogReader which reads "input" (opened in binary mode), formatting its messages with "format" (if given, otherwise
+		// using the format of the logger which wrote them)
+		BinaryLogReader(std::istream& input, const std::string& format = std::string());
 
 		// Copy constructor
 
-		// Creates a Logger instance from an already existing one
-		StreamLogger(const StreamLogger& other) noexcept;
-
-		// Destructor
-		
-		// Flush stream before deletion
-		~StreamLogger() override;
+		BinaryLogReader(const BinaryLogReader& other) = delete;
 
 		//
 		// Overloaded operators
 		//
 
 		// Assignment operator
-		StreamLogger& operator=(const StreamLogger& other) noexcept;
+		BinaryLogReader& operator=(const BinaryLogReader& other) = delete;
 
 		//
 		// Public methods
 		//
 
-		// Flush appropriate stream
-		virtual void Flush() noexcept override;
+		// Reads the next message, returns false at the end of the input (or if it ends with an incomplete message, see "IsTruncated")
+		// Throws InvalidBinaryLogException if the input is not a binary log, is corrupted or was written on a different kind of system
+		bool Next();
 
-		// Change the logger's stream type (to a different "STREAM_TYPE")
-		void SetStreamType(StreamType streamType);
+		// Get the level of the last message read (OFF for messages with no level)
+		LogLevel GetLevel() const noexcept;
+
+		// Get the time the last message read was written at
+		std::chrono::system_clock::time_point GetTime() const noexcept;
+
+		// Formats the last message read, appending it to "output"
+		void Format(std::string& output) const;
+
+		// Check if the input ended with an incomplete message (e.g. the file was still being written)
+		bool IsTruncated() const noexcept;
+
+		// Get the format used for the messages
+		using Logger::GetFormat;
+
+		// Set the format used for the messages, instead of the one of the file (or go back to it, if "format" is empty)
+		void SetFormat(const std::string& format);
+
+		// Not used, the reader only formats the messages
+		void Flush() noexcept override;
 	};
 
-	//
-	// Constructors and destructors
-	//
+	//
+	// Constructors and destructors
+	//
+
+	// Creates an instance of BinaryLogReader which reads "input" (opened in binary mode), formatting its messages with "format" (if given, otherwise
+	// using the format of the logger which wrote them)
+	inline BinaryLogReader::BinaryLogReader(std::istream& input, const std::string& format)
+		: Logger(format, false), m_Input(input), m_SessionFormat(), m_KeepFormat(!format.empty()), m_Started(false), m_Truncated(false), m_Messages(),
+		m_Time(0), m_ElapsedOrigin(0), m_Current(NO_MESSAGE), m_Level(LogLevel::OFF), m_Text(), m_Arguments()
+	{ }
+
+	//
+	// Private methods
+	//
+
+	// Reads "size" bytes into "data", returns false if the input ended first
+	inline bool BinaryLogReader::readBytes(void* data, size_t size)
+	{
+		return static_cast<size_t>(m_Input.read(static_cast<char*>(data), static_cast<std::streamsize>(size)).gcount()) == size;
+	}
+
+	// Reads a number written using 7 bits per byte, returns false if the input ended first
+	inline bool BinaryLogReader::readVarint(unsigned long long& value)
+	{
+		value = 0u;
+		for (unsigned shift = 0u; shift < 64u; shift += 7u)
+		{
+			const int byte = m_Input.get();
+			if (byte == std::char_traits<char>::eof())
+				return false;
+
+			value |= static_cast<unsigned long long>(byte & 0x7F) << shift;
+			if ((byte & 0x80) == 0)
+				return true;
+		}
+
+		throw InvalidBinaryLogException("number too large");
+	}
+
+	// Reads a signed number written using 7 bits per byte (interleaving positive and negative values), returns false if the input ended first
+	inline bool BinaryLogReader::readSignedVarint(long long& value)
+	{
+		unsigned long long bits;
+		if (!readVarint(bits))
+			return false;
 
-	// Creates an instance of Logger which outputs to a stream chosen from a STREAM_TYPE
-	// By default uses STREAM_TYPE::STDOUT and no format or auto flush
-	inline StreamLogger::StreamLogger(const StreamType& type, const std::string& format, bool autoFlush)
-		: Logger(format, autoFlush), m_StreamType(type)
-	{ }
+		value = static_cast<long long>((bits >> 1u) ^ (0u - (bits & 1u)));
+		return true;
+	}
 
-	// Creates an instance of Logger which outputs to STDOUT. Formats logs and auto flushes based on the parameter "autoFlush"
-	inline StreamLogger::StreamLogger(const std::string& format, bool autoFlush)
-		: Logger(format, autoFlush), m_StreamType(StreamType::STDOUT)
-	{ }
+	// Appends the bytes of "value" to the arguments of the current record
+	template<typename T>
+	inline void BinaryLogReader::appendArgument(const T& value)
+	{
+		m_Arguments.append(reinterpret_cast<const char*>(&value), sizeof(value));
+	}
 
-	// Creates an instance of Logger which outputs to STDOUT. Formats logs and auto flushes based on the parameter "autoFlush"
-	inline StreamLogger::StreamLogger(const char* format, bool autoFlush)
-		: Logger(format, autoFlush), m_StreamType(StreamType::STDOUT)
-	{ }
+	// Reads a string (its size followed by its characters), returns false if the input ended first
+	inline bool BinaryLogReader::readString(std::string& value)
+	{
+		unsigned long long size;
+		if (!readVarint(size))
+			return false;
+		if (size > MAX_STRING_SIZE)
+			throw InvalidBinaryLogException("string too large");
+
+		value.resize(static_cast<size_t>(size));
+		return size == 0u || readBytes(&value[0], value.size());
+	}
 
-	// Creates an instance of Logger which outputs to STDOUT. Formats logs and auto flushes based on the parameter "autoFlush"
-	inline StreamLogger::StreamLogger(bool autoFlush) noexcept
-		: Logger(std::string(), autoFlush), m_StreamType(StreamType::STDOUT)
-	{ }
+	// Reads the time of an entry, written as the difference from the time of the previous one, returns false if the input ended first
+	inline bool BinaryLogReader::readTime()
+	{
+		long long difference;
+		if (!readSignedVarint(difference))
+			return false;
 
-	// Copy constructor
+		m_Time = static_cast<long long>(static_cast<unsigned long long>(m_Time) + static_cast<unsigned long long>(difference));
+		return true;
+	}
 
-	// Creates a Logger instance from an already existing one
-	inline StreamLogger::StreamLogger(const StreamLogger& other) noexcept
-		: Logger(other), m_StreamType(other.m_StreamType)
-	{ }
+	// Reads the start of a session, checking that it can be read on this system, returns false if the input ended first
+	inline bool BinaryLogReader::readSession()
+	{
+		char magic[4];
+		unsigned char version;
+		unsigned short byteOrder;
+
+		if (!readBytes(magic, sizeof(magic)))
+			return false;
+		if (std::memcmp(magic, "BLOG", sizeof(magic)) != 0)
+			throw InvalidBinaryLogException("not a binary log");
+		if (!readBytes(&version, sizeof(version)) || !readBytes(&byteOrder, sizeof(byteOrder)))
+			return false;
+		if (version > detail::BINARY_LOG_VERSION)
+			throw InvalidBinaryLogException("unsupported version " + std::to_string(version));
+		if (byteOrder != 0x0102u)
+			throw InvalidBinaryLogException("written on a system with a different byte order");
+		if (!readSignedVarint(m_Time) || !readSignedVarint(m_ElapsedOrigin) || !readString(m_SessionFormat))
+			return false;
+
+		// Messages are only valid in the session (e.g. the file) they were written in
+		m_Messages.clear();
+		m_Started = true;
+		if (!m_KeepFormat)
+			Logger::SetFormat(m_SessionFormat);
+
+		return true;
+	}
 
-	// Destructor
+	// Reads a message of the dictionary, returns false if the input ended first
+	inline bool BinaryLogReader::readMessage()
+	{
+		unsigned long long id, indent, line;
+		unsigned char header[3];
+		Message message;
+
+		if (!readVarint(id) || !readBytes(header, sizeof(header)) || !readVarint(indent))
+			return false;
+		if (id != m_Messages.size() + 1u)
+			throw InvalidBinaryLogException("unexpected message " + std::to_string(id));
+		if (header[0] > static_cast<unsigned char>(LogLevel::OFF) || header[2] > detail::MAX_RECORD_ARGUMENTS || indent > MAX_STRING_SIZE)
+			throw InvalidBinaryLogException("invalid message " + std::to_string(id));
+
+		message.level = static_cast<LogLevel>(header[0]);
+		message.flags = header[1];
+		message.noArguments = header[2];
+		message.indent = static_cast<size_t>(indent);
+		message.line = 0u;
+		if ((message.flags & detail::BINARY_HAS_TEXT) != 0u && !readString(message.text))
+			return false;
+		if ((message.flags & detail::BINARY_HAS_CALL_SITE) != 0u)
+		{
+			if (!readVarint(line) || !readString(message.file) || !readString(message.fileName) || !readString(message.function))
+				return false;
+			message.line = static_cast<unsigned int>(line);
+		}
 
-	// Flush stream before deletion
-	inline StreamLogger::~StreamLogger()
+		m_Messages.push_back(std::move(message));
+		return true;
+	}
+
+	// Reads a record of the message "id", returns false if the input ended first
+	inline bool BinaryLogReader::readRecord(unsigned long long id)
 	{
-		switch (m_StreamType)
+		if (id > m_Messages.size())
+			throw InvalidBinaryLogException("unknown message " + std::to_string(id));
+
+		const Message& message = m_Messages[static_cast<size_t>(id - 1u)];
+		m_Current = static_cast<size_t>(id - 1u);
+		m_Level = message.level;
+		if (!readTime() || ((message.flags & detail::BINARY_HAS_TEXT) == 0u && !readString(m_Text)))
+			return false;
+
+		// The arguments are decoded back to the layout of a deferred record, to be formatted the same way
+		m_Arguments.clear();
+		for (size_t i = 0u; i < message.noArguments; ++i)
 		{
-		case StreamType::STDERR:   std::cerr.flush();       break;
-		case StreamType::STDLOG:   std::clog.flush();       break;
-		case StreamType::STDOUT:   std::cout.flush();       break;
+			const int type = m_Input.get();
+			unsigned char byte;
+			long long integer;
+			unsigned long long unsignedInteger;
+			double floatingPoint;
+			size_t position;
+
+			if (type == std::char_traits<char>::eof())
+				return false;
+			m_Arguments.push_back(static_cast<char>(type));
+
+			switch (static_cast<detail::RecordArgumentType>(type))
+			{
+			case detail::RecordArgumentType::BOOL:
+				if (!readBytes(&byte, sizeof(byte)))
+					return false;
+				if (byte > 1u)
+					throw InvalidBinaryLogException("invalid boolean argument");
+				appendArgument(byte != 0u);
+				break;
+			case detail::RecordArgumentType::CHAR:
+				if (!readBytes(&byte, sizeof(byte)))
+					return false;
+				m_Arguments.push_back(static_cast<char>(byte));
+				break;
+			case detail::RecordArgumentType::INT64:
+				if (!readSignedVarint(integer))
+					return false;
+				appendArgument(integer);
+				break;
+			case detail::RecordArgumentType::UINT64:
+				if (!readVarint(unsignedInteger))
+					return false;
+				appendArgument(unsignedInteger);
+				break;
+			case detail::RecordArgumentType::DOUBLE:
+				if (!readBytes(&floatingPoint, sizeof(floatingPoint)))
+					return false;
+				appendArgument(floatingPoint);
+				break;
+			case detail::RecordArgumentType::STRING:
+				if (!readVarint(unsignedInteger))
+					return false;
+				if (unsignedInteger > MAX_STRING_SIZE)
+					throw InvalidBinaryLogException("string too large");
+
+				appendArgument(static_cast<size_t>(unsignedInteger));
+				position = m_Arguments.size();
+				m_Arguments.resize(position + static_cast<size_t>(unsignedInteger));
+				if (unsignedInteger > 0u && !readBytes(&m_Arguments[position], static_cast<size_t>(unsignedInteger)))
+					return false;
+				break;
+			default:
+				throw InvalidBinaryLogException("unknown argument type " + std::to_string(type));
+			}
 		}
+
+		return true;
+	}
+
+	// Reads an already formatted message, returns false if the input ended first
+	inline bool BinaryLogReader::readText()
+	{
+		unsigned char level;
+
+		if (!readBytes(&level, sizeof(level)) || !readTime() || !readString(m_Text))
+			return false;
+		if (level > static_cast<unsigned char>(LogLevel::OFF))
+			throw InvalidBinaryLogException("invalid level " + std::to_string(level));
+
+		m_Current = NO_MESSAGE;
+		m_Level = static_cast<LogLevel>(level);
+		return true;
 	}
 
 	//
 	// Protected methods
 	//
 
-#if defined SBLOGGER_COLOURS || defined SBLOGGER_COLORS
-	// Adds colours where the specific placeholders are found (e.g. %colour_name{...}colour_name%)
-	inline void StreamLogger::addColours(std::string& message) const noexcept
+	// Not used, the reader only formats the messages
+	inline void BinaryLogReader::writeToStream(const std::string&)
+	{ }
+
+	//
+	// Public methods
+	//
+
+	// Reads the next message, returns false at the end of the input (or if it ends with an incomplete message, see "IsTruncated")
+	// Throws InvalidBinaryLogException if the input is not a binary log, is corrupted or was written on a different kind of system
+	inline bool BinaryLogReader::Next()
 	{
-		static struct Colours
+		unsigned long long id;
+		int type;
+
+		for (;;)
 		{
-			char name[12];
-			size_t code;
-		}colours[]{ { "reset", 0 }, { "black", 30 }, { "red", 31 }, { "green", 32 }, { "yellow", 33 }, { "blue", 34 }, { "magenta", 35 }, { "cyan", 36 }, { "white", 37 },
-				{ "bg-black", 40 }, { "bg-red", 41 }, { "bg-green", 42 }, { "bg-yellow", 43 }, { "bg-blue", 44 }, { "bg-magenta", 45 }, { "bg-cyan", 46 }, { "bg-white", 47 } };
+			if (m_Input.peek() == std::char_traits<char>::eof())
+				return false;
+			if (!readVarint(id))
+				break;
+
+			// Records start with the identifier of their message, the other entries with 0 and their type
+			if (id != 0u)
+			{
+				if (!m_Started)
+					throw InvalidBinaryLogException("not a binary log");
+				if (readRecord(id))
+					return true;
+				break;
+			}
 
-		size_t placeholderPosition, placeholderSize;
-		bool isBright;
-		char currentColour[17]{ '{' }, colourCode[6]{ '\033', '[' };
+			if ((type = m_Input.get()) == std::char_traits<char>::eof())
+				break;
+			if (!m_Started && type != static_cast<int>(detail::BinaryEntryType::SESSION))
+				throw InvalidBinaryLogException("not a binary log");
 
-		for (size_t i = 0u; i < 17u; ++i)
-			if ((placeholderPosition = message.find(colours[i].name)) != std::string::npos
-				&& placeholderPosition > 1u && message[placeholderPosition - 1u] == '{'
-				&& placeholderPosition < (message.size() - 1u) && message[placeholderPosition + std::strlen(colours[i].name)] == '}')
+			if (type == static_cast<int>(detail::BinaryEntryType::SESSION))
 			{
-				std::strncpy(currentColour + 1, colours[i].name, std::strlen(colours[i].name) + 1u);
-				std::strncat(currentColour, "}", 1u);
-				while ((placeholderPosition = message.find(currentColour)) != std::string::npos)
-				{
-					placeholderSize = std::strlen(currentColour);
-					message[placeholderPosition - 1u] == '^' ?
-						message.replace(placeholderPosition - 2u, placeholderSize + 2u, colours[i].code != 0 ? ("\033[" + std::to_string(colours[i].code + 60u) + 'm') : "\033[m")
-						: message.replace(placeholderPosition - 1u, placeholderSize + 1u, colours[i].code != 0 ? ("\033[" + std::to_string(colours[i].code) + 'm') : "\033[m");
-				}
+				if (!readSession())
+					break;
+			}
+			else if (type == static_cast<int>(detail::BinaryEntryType::MESSAGE))
+			{
+				if (!readMessage())
+					break;
+			}
+			else if (type == static_cast<int>(detail::BinaryEntryType::TEXT))
+			{
+				if (readText())
+					return true;
+				break;
 			}
+			else
+				throw InvalidBinaryLogException("unknown entry type " + std::to_string(type));
+		}
+
+		m_Truncated = true;
+		return false;
 	}
-#endif	// Adds colours where the specific placeholders are found (e.g. %colour_name{...}colour_name%)
 
-	// Writes string to appropriate stream based on instance STREAM_TYPE (m_StreamType)
-	inline void StreamLogger::writeToStream(const std::string& str)
+	// Get the level of the last message read (OFF for messages with no level)
+	inline LogLevel BinaryLogReader::GetLevel() const noexcept
 	{
-		switch (m_StreamType)
-		{
-		case StreamType::STDERR:   std::cerr << str;       if (m_AutoFlush) std::cerr.flush();       break;
-		case StreamType::STDLOG:   std::clog << str;       if (m_AutoFlush) std::clog.flush();       break;
-		default:                    std::cout << str;       if (m_AutoFlush) std::cout.flush();       break;
-		}
+		return m_Level;
 	}
 
-	//
-	// Overloaded operators
-	//
+	// Get the time the last message read was written at
+	inline std::chrono::system_clock::time_point BinaryLogReader::GetTime() const noexcept
+	{
+		return std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(m_Time)));
+	}
 
-	// Assignment operator
-	inline StreamLogger& StreamLogger::operator=(const StreamLogger& other) noexcept
+	// Formats the last message read, appending it to "output"
+	inline void BinaryLogReader::Format(std::string& output) const
 	{
-		if (this != &other)
+		if (m_Current == NO_MESSAGE)
 		{
-			m_AutoFlush = other.m_AutoFlush;
-			m_Format = other.m_Format;
-			m_IndentCount = other.m_IndentCount;
-			m_StreamType = other.m_StreamType;
+			output.append(m_Text);
+			return;
 		}
 
-		return *this;
+		const Message& message = m_Messages[m_Current];
+		const std::string& text = (message.flags & detail::BINARY_HAS_TEXT) != 0u ? message.text : m_Text;
+		const CallSite callSite{ message.file.c_str(), message.fileName.c_str(), message.line, message.function.c_str(), message.level, { CallSiteState::DEFAULT } };
+
+		// The time elapsed since the first logger of the process which wrote the file was created
+		const std::chrono::nanoseconds elapsed(m_Time - m_ElapsedOrigin);
+		detail::RecordArgumentValue values[detail::MAX_RECORD_ARGUMENTS];
+		detail::FormatArgument arguments[detail::MAX_RECORD_ARGUMENTS];
+
+		detail::decodeRecordArguments(m_Arguments.data(), message.noArguments, values, arguments);
+		output.append(message.indent, '\t');
+		renderFormat(output, m_FormatProgram, message.level, { text.data(), text.size(), nullptr, 0u, arguments, message.noArguments, false },
+			(message.flags & detail::BINARY_HAS_CALL_SITE) != 0u ? &callSite : nullptr, GetTime(), elapsed);
+		if ((message.flags & detail::BINARY_NEW_LINE) != 0u)
+			output.push_back('\n');
 	}
 
-	//
-	// Public methods
-	//
-
-	// Flush appropriate stream
-	inline void StreamLogger::Flush() noexcept
+	// Check if the input ended with an incomplete message (e.g. the file was still being written)
+	inline bool BinaryLogReader::IsTruncated() const noexcept
 	{
-		switch (m_StreamType)
-		{
-		case StreamType::STDERR:   std::cerr.flush();       break;
-		case StreamType::STDLOG:   std::clog.flush();       break;
-		default:                    std::cout.flush();       break;
-		}
+		return m_Truncated;
 	}
 
-	// Change the logger's stream type (to a different "STREAM_TYPE")
-	inline void StreamLogger::SetStreamType(StreamType streamType)
+	// Set the format used for the messages, instead of the one of the file (or go back to it, if "format" is empty)
+	inline void BinaryLogReader::SetFormat(const std::string& format)
 	{
-		m_StreamType = streamType;
+		m_KeepFormat = !format.empty();
+		Logger::SetFormat(m_KeepFormat ? format : m_SessionFormat);
 	}
 
-	//
-	// FileLogger class
-	//
+	// Not used, the reader only formats the messages
+	inline void BinaryLogReader::Flush() noexcept
+	{ }
 
-	// Used to log messages to a file stream
-	class FileLogger : public Logger
+	// Logger whose messages below "MinLevel" are compiled out (ex.: TRACE calls in a module using BasicLogger<LogLevel::INFO, StreamLogger>), writing the others
+	// through "TLogger" (ex.: StreamLogger, FileLogger). Only calls made through the BasicLogger type are removed, the ones made through a reference to
+	// "TLogger" or Logger being checked at runtime only
+	template<LogLevel MinLevel, typename TLogger>
+	class BasicLogger : public TLogger
 	{
-	protected:
-		//
-		// Protected members
-		//
-
-#ifdef SBLOGGER_LEGACY // Pre C++17 Compilers
-		std::string m_FilePath;
-#else
-		std::filesystem::path m_FilePath;
-#endif
-		std::fstream m_FileStream;
-		std::mutex m_Mutex;
+		static_assert(std::is_base_of<Logger, TLogger>::value, "TLogger must be a logger (ex.: StreamLogger, FileLogger)");
 
+	public:
 		//
-		// Protected methods
+		// Public constructors
 		//
 
-		// Writes string to file stream and flush if auto flush is set
-		virtual void writeToStream(const std::string& str) override;
+		// Initialize the logger using the constructors of "TLogger"
+		using TLogger::TLogger;
 
-	public:
 		//
-		// Constructors and destructors
+		// Public methods
 		//
 
-		// Deleted to prevent usage without providing a file path
-		FileLogger() = delete;
-
-		// Creates an instance of FileLogger which outputs to a file stream given by the "filePath" parameter
-		// By default there is no formatting and auto flush is set to true
-		FileLogger(const char* filePath, const char* format = nullptr, bool autoFlush = true);
-
-		// Creates an instance of FileLogger which outputs to a file stream given by the "filePath" parameter
-		// By default there is no formatting and auto flush is set to true
-		FileLogger(const char* filePath, const std::string& format, bool autoFlush = true);
+		// Check if messages of "logLevel" are written, which is never the case below "MinLevel"
+		bool IsEnabled(LogLevel logLevel) const noexcept;
 
-		// Creates an instance of FileLogger which outputs to a file stream given by the "filePath" parameter
-		// By default there is no formatting and auto flush is set to true
-		FileLogger(const std::string& filePath, const std::string& format = std::string(), bool autoFlush = true);
+		// Check if messages of "callSite" are written, which is never the case below "MinLevel"
+		bool IsEnabled(const CallSite& callSite) const;
 
-		// Copy constructor
+		//
+		// Generic Methods: Write a TRACE level message (compiled out if TRACE is below "MinLevel") to a stream
+		//
 
-		FileLogger(const FileLogger& other) = delete;
+		// Writes to the stream the newline character, assuming a default log level of TRACE
+		void WriteLine(LogLevel logLevel = LogLevel::TRACE);
 
-		// Move constructor
+		// Writes to the stream a message and inserts values into placeholders (should they exist), assuming a default log level of TRACE
+		template<typename TMessage, typename ...T>
+		detail::EnableIfRuntimeMessage<TMessage> Write(const TMessage& message, const T& ...t);
+#ifndef SBLOGGER_LEGACY
 
-		FileLogger(FileLogger&& other) = delete;
+		// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), assuming a default log level of TRACE
+		template<typename ...T>
+		void Write(FormatString<detail::Identity<T>...> message, const T& ...t);
+#endif
 
-		// Destructor
+		// Writes to the stream a message and inserts values into placeholders (should they exist) and finishes with the newline character, assuming a default log level of TRACE
+		template<typename TMessage, typename ...T>
+		detail::EnableIfRuntimeMessage<TMessage> WriteLine(const TMessage& message, const T& ...t);
+#ifndef SBLOGGER_LEGACY
 
-		// Flush and close stream if open
-		virtual ~FileLogger() override;
+		// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist) and finishes with the newline character, assuming a default log level of TRACE
+		template<typename ...T>
+		void WriteLine(FormatString<detail::Identity<T>...> message, const T& ...t);
+#endif
 
 		//
-		// Overloaded operators
+		// Generic Methods: Write a level message (checked against "MinLevel" at runtime) to a stream
 		//
 
-		// Assignment operator (deleted since having two streams for the same file causes certain output not to be written).
-		FileLogger& operator=(const FileLogger& other) = delete;
-
-		//
-		// Public methods
-		//
+		// Writes to the stream a message and inserts values into placeholders (should they exist), of "logLevel" importance
+		template<typename TMessage, typename ...T>
+		detail::EnableIfRuntimeMessage<TMessage> Write(LogLevel logLevel, const TMessage& message, const T& ...t);
+#ifndef SBLOGGER_LEGACY
 
-		// Get the file path
-#ifdef SBLOGGER_LEGACY
-		std::string GetFilePath() const noexcept;
-#else
-		std::filesystem::path GetFilePath() const noexcept;
+		// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of "logLevel" importance
+		template<typename ...T>
+		void Write(LogLevel logLevel, FormatString<detail::Identity<T>...> message, const T& ...t);
 #endif
 
-		// Flush file stream
-		virtual void Flush() noexcept override;
-
-		// Indent (prepend '\t') log, returns the number of indents the final message will contain
-		virtual size_t Indent() noexcept override;
-
-		// Dedent (remove '\t') log, returns the number of indents the final message will contain
-		virtual size_t Dedent() noexcept override;
+		// Writes to the stream a message and inserts values into placeholders (should they exist) and finishes with the newline character, of "logLevel" importance
+		template<typename TMessage, typename ...T>
+		detail::EnableIfRuntimeMessage<TMessage> WriteLine(LogLevel logLevel, const TMessage& message, const T& ...t);
+#ifndef SBLOGGER_LEGACY
 
-		// Clear log file
-		virtual void ClearLogs() noexcept;
-	};
+		// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist) and finishes with the newline character, of "logLevel" importance
+		template<typename ...T>
+		void WriteLine(LogLevel logLevel, FormatString<detail::Identity<T>...> message, const T& ...t);
+#endif
 
-	//
-	// Constructors and destructors
-	//
+		//
+		// Generic Methods: Write a TRACE level message (compiled out if TRACE is below "MinLevel") to a stream
+		//
 
-	// Creates an instance of FileLogger which outputs to a file stream given by the "filePath" parameter
-	// By default there is no formatting and auto flush is set to true
-	inline FileLogger::FileLogger(const char* filePath, const char* format, bool autoFlush)
-		: Logger(format == nullptr ? "" : format, autoFlush)
-	{
-		if (filePath == nullptr || filePath[0] == '\0') throw NullOrEmptyPathException();
+		// Writes to the stream a message and inserts values into placeholders (should they exist), of TRACE importance
+		template<typename TMessage, typename ...T>
+		detail::EnableIfRuntimeMessage<TMessage> Trace(const TMessage& message, const T& ...t);
+#ifndef SBLOGGER_LEGACY
 
-		std::string formattedFilePath(filePath);
-		addPadding(formattedFilePath);
-		addColours(formattedFilePath);
-		replacePredefinedPlaceholders(formattedFilePath);
-		replaceCurrentLevel(formattedFilePath);
-		replaceOthers(formattedFilePath, nullptr, nullptr, nullptr);
-		replaceDateFormats(formattedFilePath);
-#ifdef SBLOGGER_LEGACY // Pre C++17 Compilers
-		m_FilePath = formattedFilePath;
-		if (!std::regex_match(m_FilePath, SBLOGGER_FILE_PATH_REGEX)) throw InvalidFilePathException(m_FilePath);
-#else
-		m_FilePath = std::filesystem::path(formattedFilePath);
-		// Check file path for null, empty, inexistent or whitespace only paths and filenames
-		if (!m_FilePath.has_filename() || !m_FilePath.has_extension()) throw NullOrEmptyPathException();
-		if (m_FilePath.filename().replace_extension().string().find_first_not_of(' ') == std::string::npos) throw NullOrWhitespaceNameException();
-		auto parentPath = m_FilePath.parent_path();
-		if (!parentPath.empty() && !std::filesystem::directory_entry(parentPath).exists()) throw InvalidFilePathException(formattedFilePath);
+		// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of TRACE importance
+		template<typename ...T>
+		void Trace(FormatString<detail::Identity<T>...> message, const T& ...t);
 #endif
-		m_FileStream = std::fstream(m_FilePath, std::fstream::app | std::fstream::out);
 
-#ifdef SBLOGGER_LEGACY // Pre C++17 Compilers
-		if (!m_FileStream.is_open()) throw InvalidFilePathException(m_FilePath);
-#else
-		if (!m_FileStream.is_open()) throw InvalidFilePathException(formattedFilePath);
-#endif
-	}
+		//
+		// Generic Methods: Write a DEBUG level message (compiled out if DEBUG is below "MinLevel") to a stream
+		//
 
-	// Creates an instance of FileLogger which outputs to a file stream given by the "filePath" parameter
-	// By default there is no formatting and auto flush is set to true
-	inline FileLogger::FileLogger(const char* filePath, const std::string& format, bool autoFlush)
-		: Logger(format, autoFlush)
-	{
-		if (filePath == nullptr || filePath[0] == '\0') throw NullOrEmptyPathException();
+		// Writes to the stream a message and inserts values into placeholders (should they exist), of DEBUG importance
+		template<typename TMessage, typename ...T>
+		detail::EnableIfRuntimeMessage<TMessage> Debug(const TMessage& message, const T& ...t);
+#ifndef SBLOGGER_LEGACY
 
-		std::string formattedFilePath(filePath);
-		addPadding(formattedFilePath);
-		addColours(formattedFilePath);
-		replacePredefinedPlaceholders(formattedFilePath);
-		replaceCurrentLevel(formattedFilePath);
-		replaceOthers(formattedFilePath, nullptr, nullptr, nullptr);
-		replaceDateFormats(formattedFilePath);
-#ifdef SBLOGGER_LEGACY // Pre C++17 Compilers
-		m_FilePath = formattedFilePath;
-		if (!std::regex_match(m_FilePath, SBLOGGER_FILE_PATH_REGEX)) throw InvalidFilePathException(m_FilePath);
-#else
-		m_FilePath = std::filesystem::path(formattedFilePath);
-		// Check file path for null, empty, inexistent or whitespace only paths and filenames
-		if (!m_FilePath.has_filename() || !m_FilePath.has_extension()) throw NullOrEmptyPathException();
-		if (m_FilePath.filename().replace_extension().string().find_first_not_of(' ') == std::string::npos) throw NullOrWhitespaceNameException();
-		if (!std::filesystem::directory_entry(m_FilePath.parent_path()).exists()) throw InvalidFilePathException(formattedFilePath);
+		// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of DEBUG importance
+		template<typename ...T>
+		void Debug(FormatString<detail::Identity<T>...> message, const T& ...t);
 #endif
-		m_FileStream = std::fstream(m_FilePath, std::fstream::app | std::fstream::out);
 
-#ifdef SBLOGGER_LEGACY // Pre C++17 Compilers
-		if (!m_FileStream.is_open()) throw InvalidFilePathException(m_FilePath);
-#else
-		if (!m_FileStream.is_open()) throw InvalidFilePathException(formattedFilePath);
-#endif
-	}
+		//
+		// Generic Methods: Write a INFO level message (compiled out if INFO is below "MinLevel") to a stream
+		//
 
-	// Creates an instance of FileLogger which outputs to a file stream given by the "filePath" parameter
-	// By default there is no formatting and auto flush is set to true
-	inline FileLogger::FileLogger(const std::string& filePath, const std::string& format, bool autoFlush)
-		: Logger(format, autoFlush)
-	{
-		std::string formattedFilePath(filePath);
-		addPadding(formattedFilePath);
-		addColours(formattedFilePath);
-		replacePredefinedPlaceholders(formattedFilePath);
-		replaceCurrentLevel(formattedFilePath);
-		replaceOthers(formattedFilePath, nullptr, nullptr, nullptr);
-		replaceDateFormats(formattedFilePath);
-#ifdef SBLOGGER_LEGACY // Pre C++17 Compilers
-		m_FilePath = formattedFilePath;
-		if (!std::regex_match(m_FilePath, SBLOGGER_FILE_PATH_REGEX)) throw InvalidFilePathException(m_FilePath);
-#else
-		m_FilePath = std::filesystem::path(formattedFilePath);
-		// Check file path for null, empty, inexistent or whitespace only paths and filenames
-		if (!m_FilePath.has_filename() || !m_FilePath.has_extension()) throw NullOrEmptyPathException();
-		if (m_FilePath.filename().replace_extension().string().find_first_not_of(' ') == std::string::npos) throw NullOrWhitespaceNameException();
-		if (!std::filesystem::directory_entry(m_FilePath.parent_path()).exists()) throw InvalidFilePathException(formattedFilePath);
+		// Writes to the stream a message and inserts values into placeholders (should they exist), of INFO importance
+		template<typename TMessage, typename ...T>
+		detail::EnableIfRuntimeMessage<TMessage> Info(const TMessage& message, const T& ...t);
+#ifndef SBLOGGER_LEGACY
+
+		// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of INFO importance
+		template<typename ...T>
+		void Info(FormatString<detail::Identity<T>...> message, const T& ...t);
 #endif
-		m_FileStream = std::fstream(m_FilePath, std::fstream::app | std::fstream::out);
 
-#ifdef SBLOGGER_LEGACY // Pre C++17 Compilers
-		if (!m_FileStream.is_open()) throw InvalidFilePathException(m_FilePath);
-#else
-		if (!m_FileStream.is_open()) throw InvalidFilePathException(formattedFilePath);
+		//
+		// Generic Methods: Write a WARN level message (compiled out if WARN is below "MinLevel") to a stream
+		//
+
+		// Writes to the stream a message and inserts values into placeholders (should they exist), of WARN importance
+		template<typename TMessage, typename ...T>
+		detail::EnableIfRuntimeMessage<TMessage> Warn(const TMessage& message, const T& ...t);
+#ifndef SBLOGGER_LEGACY
+
+		// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of WARN importance
+		template<typename ...T>
+		void Warn(FormatString<detail::Identity<T>...> message, const T& ...t);
 #endif
-	}
 
-	// Destructor
+		//
+		// Generic Methods: Write a ERROR level message (compiled out if ERROR is below "MinLevel") to a stream
+		//
 
-	// Flush and close stream if open
-	inline FileLogger::~FileLogger()
-	{
-		std::lock_guard<std::mutex> lock(m_Mutex);
+		// Writes to the stream a message and inserts values into placeholders (should they exist), of ERROR importance
+		template<typename TMessage, typename ...T>
+		detail::EnableIfRuntimeMessage<TMessage> Error(const TMessage& message, const T& ...t);
+#ifndef SBLOGGER_LEGACY
 
-		if (m_FileStream.is_open())
-		{
-			m_FileStream.flush();
-			m_FileStream.close();
-		}
-	}
+		// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of ERROR importance
+		template<typename ...T>
+		void Error(FormatString<detail::Identity<T>...> message, const T& ...t);
+#endif
+
+		//
+		// Generic Methods: Write a CRITICAL level message (compiled out if CRITICAL is below "MinLevel") to a stream
+		//
+
+		// Writes to the stream a message and inserts values into placeholders (should they exist), of CRITICAL importance
+		template<typename TMessage, typename ...T>
+		detail::EnableIfRuntimeMessage<TMessage> Critical(const TMessage& message, const T& ...t);
+#ifndef SBLOGGER_LEGACY
+
+		// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of CRITICAL importance
+		template<typename ...T>
+		void Critical(FormatString<detail::Identity<T>...> message, const T& ...t);
+#endif
+	};
+	template<LogLevel MinLevel, typename TLogger>
+	using basic_logger = BasicLogger<MinLevel, TLogger>;
 
 	//
-	// Private methods
+	// Public methods
 	//
 
-	// Writes string to file stream and flush if auto flush is set
-	inline void FileLogger::writeToStream(const std::string& str)
+	// Check if messages of "logLevel" are written, which is never the case below "MinLevel"
+	template<LogLevel MinLevel, typename TLogger>
+	inline bool BasicLogger<MinLevel, TLogger>::IsEnabled(LogLevel logLevel) const noexcept
 	{
-		std::lock_guard<std::mutex> lock(m_Mutex);
-		if (!m_FileStream.is_open())
-#ifdef SBLOGGER_LEGACY // Pre C++17 Compilers
-			std::cerr << "The file stream " + m_FilePath + " is not opened.";
-#else
-			std::cerr << "The file stream " + m_FilePath.string() + " is not opened.";
-#endif
-		else
-		{
-			m_FileStream << str;
-			if (m_AutoFlush) 
-				m_FileStream.flush();
-		}
+		return logLevel >= MinLevel && TLogger::IsEnabled(logLevel);
+	}
+
+	// Check if messages of "callSite" are written, which is never the case below "MinLevel"
+	template<LogLevel MinLevel, typename TLogger>
+	inline bool BasicLogger<MinLevel, TLogger>::IsEnabled(const CallSite& callSite) const
+	{
+		return callSite.level >= MinLevel && TLogger::IsEnabled(callSite);
 	}
 
 	//
-	// Public methods
+	// Generic write methods to write a TRACE level message (compiled out if TRACE is below "MinLevel") to the stream
 	//
 
-	// Get the file path
-#ifdef SBLOGGER_LEGACY
-	std::string FileLogger::GetFilePath() const noexcept
-#else
-	std::filesystem::path FileLogger::GetFilePath() const noexcept
-#endif
+	// Writes to the stream the newline character, assuming a default log level of TRACE
+	template<LogLevel MinLevel, typename TLogger>
+	inline void BasicLogger<MinLevel, TLogger>::WriteLine(LogLevel logLevel)
 	{
-		return m_FilePath;
+		if (logLevel >= MinLevel)
+			TLogger::WriteLine(logLevel);
 	}
 
-	// Flush file stream
-	inline void FileLogger::Flush() noexcept
+	// Writes to the stream a message and inserts values into placeholders (should they exist), assuming a default log level of TRACE
+	template<LogLevel MinLevel, typename TLogger>
+	template<typename TMessage, typename ...T>
+	inline detail::EnableIfRuntimeMessage<TMessage> BasicLogger<MinLevel, TLogger>::Write(const TMessage& message, const T& ...t)
 	{
-		std::lock_guard<std::mutex> lock(m_Mutex);
-		if (m_FileStream.is_open())
-			m_FileStream.flush();
+		SBLOGGER_IF_CONSTEXPR(LogLevel::TRACE >= MinLevel)
+			TLogger::Write(message, t...);
 	}
+#ifndef SBLOGGER_LEGACY
 
-	// Indent (prepend '\t') log, returns the number of indents the final message will contain
-	inline size_t FileLogger::Indent() noexcept
+	// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), assuming a default log level of TRACE
+	template<LogLevel MinLevel, typename TLogger>
+	template<typename ...T>
+	inline void BasicLogger<MinLevel, TLogger>::Write(FormatString<detail::Identity<T>...> message, const T& ...t)
 	{
-		std::lock_guard<std::mutex> lock(m_Mutex);
-		return ++m_IndentCount;
+		SBLOGGER_IF_CONSTEXPR(LogLevel::TRACE >= MinLevel)
+			TLogger::Write(message, t...);
 	}
+#endif
 
-	// Dedent (prepend '\t') log, returns the number of indents the final message will contain
-	inline size_t FileLogger::Dedent() noexcept
+	// Writes to the stream a message and inserts values into placeholders (should they exist) and finishes with the newline character, assuming a default log level of TRACE
+	template<LogLevel MinLevel, typename TLogger>
+	template<typename TMessage, typename ...T>
+	inline detail::EnableIfRuntimeMessage<TMessage> BasicLogger<MinLevel, TLogger>::WriteLine(const TMessage& message, const T& ...t)
 	{
-		std::lock_guard<std::mutex> lock(m_Mutex);
-		return m_IndentCount > 0 ? --m_IndentCount : m_IndentCount;
+		SBLOGGER_IF_CONSTEXPR(LogLevel::TRACE >= MinLevel)
+			TLogger::WriteLine(message, t...);
 	}
+#ifndef SBLOGGER_LEGACY
 
-	// Clear log file
-	inline void FileLogger::ClearLogs() noexcept
+	// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist) and finishes with the newline character, assuming a default log level of TRACE
+	template<LogLevel MinLevel, typename TLogger>
+	template<typename ...T>
+	inline void BasicLogger<MinLevel, TLogger>::WriteLine(FormatString<detail::Identity<T>...> message, const T& ...t)
 	{
-		std::lock_guard<std::mutex> lock(m_Mutex);
-		if (m_FileStream.is_open())
-		{
-#ifdef SBLOGGER_LEGACY
-			m_FileStream.close();
-			m_FileStream = std::fstream(m_FilePath, std::ofstream::out | std::ofstream::trunc);
-#else
-			std::filesystem::resize_file(m_FilePath, 0);
-			m_FileStream.seekp(0);
-#endif
-		}
+		SBLOGGER_IF_CONSTEXPR(LogLevel::TRACE >= MinLevel)
+			TLogger::WriteLine(message, t...);
 	}
+#endif
 
 	//
-	// DailyLogger class
+	// Generic write methods to write a level message (checked against "MinLevel" at runtime) to the stream
 	//
 
-	// Used to log messages to a file stream, recreated daily at the specified time point
-	class DailyLogger : public FileLogger
+	// Writes to the stream a message and inserts values into placeholders (should they exist), of "logLevel" importance
+	template<LogLevel MinLevel, typename TLogger>
+	template<typename TMessage, typename ...T>
+	inline detail::EnableIfRuntimeMessage<TMessage> BasicLogger<MinLevel, TLogger>::Write(LogLevel logLevel, const TMessage& message, const T& ...t)
 	{
-		//
-		// Private members
-		//
-
-		std::thread m_FileChangeThread;
-		std::string m_FileNameFormat;
-		std::chrono::system_clock::time_point m_NextChangeTime;
-		int m_Hours, m_Minutes, m_Seconds;
-		bool m_Stop;
-		
-		//
-		// Protected methods
-		//
-
-		// Check if it is time to change the current file (closing it) and open the new one, according to the time provided
-		void changeFile();
-
-	public:
-		//
-		// Constructors and destructors
-		//
-
-		// Deleted to prevent usage without providing a file path and time to change it at
-		DailyLogger() = delete;
-
-		// Creates an instance of DailyLogger which outputs to a file stream given by the "filePath" parameter, which will be recreated at the specified interval
-		// By default there is no formatting and auto flush is set to true
-		DailyLogger(const char* filePath, const char* format = nullptr, int hour = 0, int minutes = 0, int seconds = 0, bool autoFlush = true);
-
-		// Creates an instance of DailyLogger which outputs to a file stream given by the "filePath" parameter, which will be recreated at the specified interval
-		// By default there is no formatting and auto flush is set to true
-		DailyLogger(const char* filePath, const std::string& format, int hour = 0, int minutes = 0, int seconds = 0, bool autoFlush = true);
-
-		// Creates an instance of DailyLogger which outputs to a file stream given by the "filePath" parameter, which will be recreated at the specified interval
-		// By default there is no formatting and auto flush is set to true
-		DailyLogger(const std::string& filePath, const std::string& format = std::string(), int hour = 0, int minutes = 0, int seconds = 0, bool autoFlush = true);
+		if (logLevel >= MinLevel)
+			TLogger::Write(logLevel, message, t...);
+	}
+#ifndef SBLOGGER_LEGACY
 
-		// Creates an instance of DailyLogger which outputs to a file stream given by the "filePath" parameter, which will be recreated at the specified interval
-		// By default there is no formatting and auto flush is set to true
-		DailyLogger(const std::string&& filePath, const std::string&& format = std::string(), int hour = 0, int minutes = 0, int seconds = 0, bool autoFlush = true);
+	// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of "logLevel" importance
+	template<LogLevel MinLevel, typename TLogger>
+	template<typename ...T>
+	inline void BasicLogger<MinLevel, TLogger>::Write(LogLevel logLevel, FormatString<detail::Identity<T>...> message, const T& ...t)
+	{
+		if (logLevel >= MinLevel)
+			TLogger::Write(logLevel, message, t...);
+	}
+#endif
 
-		// Copy constructor
+	// Writes to the stream a message and inserts values into placeholders (should they exist) and finishes with the newline character, of "logLevel" importance
+	template<LogLevel MinLevel, typename TLogger>
+	template<typename TMessage, typename ...T>
+	inline detail::EnableIfRuntimeMessage<TMessage> BasicLogger<MinLevel, TLogger>::WriteLine(LogLevel logLevel, const TMessage& message, const T& ...t)
+	{
+		if (logLevel >= MinLevel)
+			TLogger::WriteLine(logLevel, message, t...);
+	}
+#ifndef SBLOGGER_LEGACY
 
-		DailyLogger(const DailyLogger& other) = delete;
+	// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist) and finishes with the newline character, of "logLevel" importance
+	template<LogLevel MinLevel, typename TLogger>
+	template<typename ...T>
+	inline void BasicLogger<MinLevel, TLogger>::WriteLine(LogLevel logLevel, FormatString<detail::Identity<T>...> message, const T& ...t)
+	{
+		if (logLevel >= MinLevel)
+			TLogger::WriteLine(logLevel, message, t...);
+	}
+#endif
 
-		// Move constructor
+	//
+	// Generic write methods to write a TRACE level message (compiled out if TRACE is below "MinLevel") to the stream
+	//
 
-		DailyLogger(DailyLogger&& other) = delete;
+	// Writes to the stream a message and inserts values into placeholders (should they exist), of TRACE importance
+	template<LogLevel MinLevel, typename TLogger>
+	template<typename TMessage, typename ...T>
+	inline detail::EnableIfRuntimeMessage<TMessage> BasicLogger<MinLevel, TLogger>::Trace(const TMessage& message, const T& ...t)
+	{
+		SBLOGGER_IF_CONSTEXPR(LogLevel::TRACE >= MinLevel)
+			TLogger::Trace(message, t...);
+	}
+#ifndef SBLOGGER_LEGACY
 
-		// Destructor
+	// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of TRACE importance
+	template<LogLevel MinLevel, typename TLogger>
+	template<typename ...T>
+	inline void BasicLogger<MinLevel, TLogger>::Trace(FormatString<detail::Identity<T>...> message, const T& ...t)
+	{
+		SBLOGGER_IF_CONSTEXPR(LogLevel::TRACE >= MinLevel)
+			TLogger::Trace(message, t...);
+	}
+#endif
 
-		// Flush and close stream if open
-		~DailyLogger() override;
+	//
+	// Generic write methods to write a DEBUG level message (compiled out if DEBUG is below "MinLevel") to the stream
+	//
 
-		//
-		// Overloaded operators
-		//
+	// Writes to the stream a message and inserts values into placeholders (should they exist), of DEBUG importance
+	template<LogLevel MinLevel, typename TLogger>
+	template<typename TMessage, typename ...T>
+	inline detail::EnableIfRuntimeMessage<TMessage> BasicLogger<MinLevel, TLogger>::Debug(const TMessage& message, const T& ...t)
+	{
+		SBLOGGER_IF_CONSTEXPR(LogLevel::DEBUG >= MinLevel)
+			TLogger::Debug(message, t...);
+	}
+#ifndef SBLOGGER_LEGACY
 
-		// Assignment operator (deleted since having two streams for the same file causes certain output not to be written).
-		DailyLogger& operator=(const DailyLogger& other) = delete;
-	};
+	// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of DEBUG importance
+	template<LogLevel MinLevel, typename TLogger>
+	template<typename ...T>
+	inline void BasicLogger<MinLevel, TLogger>::Debug(FormatString<detail::Identity<T>...> message, const T& ...t)
+	{
+		SBLOGGER_IF_CONSTEXPR(LogLevel::DEBUG >= MinLevel)
+			TLogger::Debug(message, t...);
+	}
+#endif
 
 	//
-	// Constructors and destructors
+	// Generic write methods to write a INFO level message (compiled out if INFO is below "MinLevel") to the stream
 	//
 
-	// Creates an instance of DailyLogger which outputs to a file stream given by the "filePath" parameter, which will be recreated at the specified interval
-	// By default there is no formatting and auto flush is set to true
-	inline DailyLogger::DailyLogger(const char* filePath, const char* format, int hour, int minutes, int seconds, bool autoFlush)
-		: FileLogger(filePath, format, autoFlush), m_FileNameFormat(filePath), m_Stop(false)
+	// Writes to the stream a message and inserts values into placeholders (should they exist), of INFO importance
+	template<LogLevel MinLevel, typename TLogger>
+	template<typename TMessage, typename ...T>
+	inline detail::EnableIfRuntimeMessage<TMessage> BasicLogger<MinLevel, TLogger>::Info(const TMessage& message, const T& ...t)
 	{
-		if (hour < 0 || hour > 23)			throw TimeRangeException();
-		if (minutes < 0 || minutes > 59)	throw TimeRangeException();
-		if (seconds < 0 || seconds > 59)	throw TimeRangeException();
-
-		// Set the date using time_t and mktime (pre C++20)
-#ifdef SBLOGGER_OLD_DATES
-		auto tt = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-		auto newTime = *std::localtime(&tt);
-		newTime.tm_sec = m_Seconds;
-		newTime.tm_min = m_Minutes;
-		newTime.tm_hour = m_Hours;
-		newTime.tm_mday++;
-		tt = std::mktime(&newTime);
-		m_NextChangeTime = std::chrono::system_clock::from_time_t(tt);
-#else
-// Set the date using C++20 (or later) methods
-#endif
-		m_FileChangeThread = std::thread(&DailyLogger::changeFile, this);
+		SBLOGGER_IF_CONSTEXPR(LogLevel::INFO >= MinLevel)
+			TLogger::Info(message, t...);
 	}
+#ifndef SBLOGGER_LEGACY
 
-	// Creates an instance of DailyLogger which outputs to a file stream given by the "filePath" parameter, which will be recreated at the specified interval
-	// By default there is no formatting and auto flush is set to true
-	inline DailyLogger::DailyLogger(const char* filePath, const std::string& format, int hour, int minutes, int seconds, bool autoFlush)
-		: FileLogger(filePath, format, autoFlush), m_FileNameFormat(filePath), m_Stop(false)
+	// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of INFO importance
+	template<LogLevel MinLevel, typename TLogger>
+	template<typename ...T>
+	inline void BasicLogger<MinLevel, TLogger>::Info(FormatString<detail::Identity<T>...> message, const T& ...t)
 	{
-		if (hour < 0 || hour > 23)			throw TimeRangeException();
-		if (minutes < 0 || minutes > 59)	throw TimeRangeException();
-		if (seconds < 0 || seconds > 59)	throw TimeRangeException();
-
-// Set the date using time_t and mktime (pre C++20)
-#ifdef SBLOGGER_OLD_DATES
-		auto tt = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-		auto newTime = *std::localtime(&tt);
-		newTime.tm_sec = m_Seconds;
-		newTime.tm_min = m_Minutes;
-		newTime.tm_hour = m_Hours;
-		newTime.tm_mday++;
-		tt = std::mktime(&newTime);
-		m_NextChangeTime = std::chrono::system_clock::from_time_t(tt);
-#else
-// Set the date using C++20 (or later) methods
-#endif
-		m_FileChangeThread = std::thread(&DailyLogger::changeFile, this);
+		SBLOGGER_IF_CONSTEXPR(LogLevel::INFO >= MinLevel)
+			TLogger::Info(message, t...);
 	}
+#endif
 
-	// Creates an instance of DailyLogger which outputs to a file stream given by the "filePath" parameter, which will be recreated at the specified interval
-	// By default there is no formatting and auto flush is set to true
-	inline DailyLogger::DailyLogger(const std::string& filePath, const std::string& format, int hour, int minutes, int seconds, bool autoFlush)
-		: FileLogger(filePath, format, autoFlush), m_FileNameFormat(filePath), m_Stop(false)
-	{
-		if (hour < 0 || hour > 23)			throw TimeRangeException();
-		if (minutes < 0 || minutes > 59)	throw TimeRangeException();
-		if (seconds < 0 || seconds > 59)	throw TimeRangeException();
+	//
+	// Generic write methods to write a WARN level message (compiled out if WARN is below "MinLevel") to the stream
+	//
 
-// Set the date using time_t and mktime (pre C++20)
-#ifdef SBLOGGER_OLD_DATES
-		auto tt = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-		auto newTime = *std::localtime(&tt);
-		newTime.tm_sec = m_Seconds;
-		newTime.tm_min = m_Minutes;
-		newTime.tm_hour = m_Hours;
-		newTime.tm_mday++;
-		tt = std::mktime(&newTime);
-		m_NextChangeTime = std::chrono::system_clock::from_time_t(tt);
-#else
-// Set the date using C++20 (or later) methods
-#endif
-		m_FileChangeThread = std::thread(&DailyLogger::changeFile, this);
+	// Writes to the stream a message and inserts values into placeholders (should they exist), of WARN importance
+	template<LogLevel MinLevel, typename TLogger>
+	template<typename TMessage, typename ...T>
+	inline detail::EnableIfRuntimeMessage<TMessage> BasicLogger<MinLevel, TLogger>::Warn(const TMessage& message, const T& ...t)
+	{
+		SBLOGGER_IF_CONSTEXPR(LogLevel::WARN >= MinLevel)
+			TLogger::Warn(message, t...);
 	}
+#ifndef SBLOGGER_LEGACY
 
-	// Creates an instance of DailyLogger which outputs to a file stream given by the "filePath" parameter, which will be recreated at the specified interval
-	// By default there is no formatting and auto flush is set to true
-	inline DailyLogger::DailyLogger(const std::string&& filePath, const std::string&& format, int hour, int minutes, int seconds, bool autoFlush)
-		: FileLogger(filePath, format, autoFlush), m_FileNameFormat(filePath), m_Stop(false)
+	// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of WARN importance
+	template<LogLevel MinLevel, typename TLogger>
+	template<typename ...T>
+	inline void BasicLogger<MinLevel, TLogger>::Warn(FormatString<detail::Identity<T>...> message, const T& ...t)
 	{
-		if (hour < 0 || hour > 23)			throw TimeRangeException();
-		if (minutes < 0 || minutes > 59)	throw TimeRangeException();
-		if (seconds < 0 || seconds > 59)	throw TimeRangeException();
-
-// Set the date using time_t and mktime (pre C++20)
-#ifdef SBLOGGER_OLD_DATES
-		auto tt = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-		auto newTime = *std::localtime(&tt);
-		newTime.tm_sec = m_Seconds;
-		newTime.tm_min = m_Minutes;
-		newTime.tm_hour = m_Hours;
-		newTime.tm_mday++;
-		tt = std::mktime(&newTime);
-		m_NextChangeTime = std::chrono::system_clock::from_time_t(tt);
-#else
-// Set the date using C++20 (or later) methods
-#endif
-		m_FileChangeThread = std::thread(&DailyLogger::changeFile, this);
+		SBLOGGER_IF_CONSTEXPR(LogLevel::WARN >= MinLevel)
+			TLogger::Warn(message, t...);
 	}
+#endif
 
-	// Destructor
+	//
+	// Generic write methods to write a ERROR level message (compiled out if ERROR is below "MinLevel") to the stream
+	//
 
-	// Flush and close stream if open
-	inline DailyLogger::~DailyLogger()
+	// Writes to the stream a message and inserts values into placeholders (should they exist), of ERROR importance
+	template<LogLevel MinLevel, typename TLogger>
+	template<typename TMessage, typename ...T>
+	inline detail::EnableIfRuntimeMessage<TMessage> BasicLogger<MinLevel, TLogger>::Error(const TMessage& message, const T& ...t)
 	{
-		std::lock_guard<std::mutex> lock(m_Mutex);
-		m_Stop = true;
-
-		if (m_FileChangeThread.joinable())
-			m_FileChangeThread.join();
+		SBLOGGER_IF_CONSTEXPR(LogLevel::ERROR >= MinLevel)
+			TLogger::Error(message, t...);
+	}
+#ifndef SBLOGGER_LEGACY
 
-		if (m_FileStream.is_open())
-		{
-			m_FileStream.flush();
-			m_FileStream.close();
-		}
+	// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of ERROR importance
+	template<LogLevel MinLevel, typename TLogger>
+	template<typename ...T>
+	inline void BasicLogger<MinLevel, TLogger>::Error(FormatString<detail::Identity<T>...> message, const T& ...t)
+	{
+		SBLOGGER_IF_CONSTEXPR(LogLevel::ERROR >= MinLevel)
+			TLogger::Error(message, t...);
 	}
+#endif
 
 	//
-	// Protected methods
+	// Generic write methods to write a CRITICAL level message (compiled out if CRITICAL is below "MinLevel") to the stream
 	//
 
-	// Check if it is time to change the current file (closing it) and open the new one, according to the time provided
-	inline void DailyLogger::changeFile()
+	// Writes to the stream a message and inserts values into placeholders (should they exist), of CRITICAL importance
+	template<LogLevel MinLevel, typename TLogger>
+	template<typename TMessage, typename ...T>
+	inline detail::EnableIfRuntimeMessage<TMessage> BasicLogger<MinLevel, TLogger>::Critical(const TMessage& message, const T& ...t)
 	{
-		auto delay = std::chrono::minutes(1);
-		auto now = std::chrono::system_clock::now() + delay;
-
-		while (!m_Stop)
-		{
-			while (now < m_NextChangeTime)
-			{
-				std::this_thread::sleep_for(delay);
-				now = std::chrono::system_clock::now() + delay;
-			}
-
-			if (!m_Stop)
-			{
-// Set the date using time_t and mktime (pre C++20)
-#ifdef SBLOGGER_OLD_DATES
-				auto tt = std::chrono::system_clock::to_time_t(m_NextChangeTime);
-				auto newTime = *std::localtime(&tt);
-				newTime.tm_sec = m_Seconds;
-				newTime.tm_min = m_Minutes;
-				newTime.tm_hour = m_Hours;
-				newTime.tm_mday++;
-				tt = std::mktime(&newTime);
-				m_NextChangeTime = std::chrono::system_clock::from_time_t(tt);
-#else
-// Set the date using C++20 (or later) methods
-#endif
+		SBLOGGER_IF_CONSTEXPR(LogLevel::CRITICAL >= MinLevel)
+			TLogger::Critical(message, t...);
+	}
+#ifndef SBLOGGER_LEGACY
 
-				std::lock_guard<std::mutex> lock(m_Mutex);
-				if (m_FileStream.is_open())
-				{
-					m_FileStream.flush();
-					m_FileStream.close();
-				}
-				std::string formattedFilePath(m_FileNameFormat);
-				addPadding(formattedFilePath);
-				addColours(formattedFilePath);
-				replacePredefinedPlaceholders(formattedFilePath);
-				replaceCurrentLevel(formattedFilePath);
-				replaceOthers(formattedFilePath, nullptr, nullptr, nullptr);
-				replaceDateFormats(formattedFilePath);
-				m_FileStream = std::fstream((m_FilePath = formattedFilePath), std::ios::out | std::ios::trunc);
-			}
-		}
+	// Writes to the stream a format string (checked and split at compile time) and inserts values into placeholders (should they exist), of CRITICAL importance
+	template<LogLevel MinLevel, typename TLogger>
+	template<typename ...T>
+	inline void BasicLogger<MinLevel, TLogger>::Critical(FormatString<detail::Identity<T>...> message, const T& ...t)
+	{
+		SBLOGGER_IF_CONSTEXPR(LogLevel::CRITICAL >= MinLevel)
+			TLogger::Critical(message, t...);
 	}
+#endif
 }
 
 //
 // Macros for logging. Adds support for file, line and function info in logs.
+// Each one creates a static call site (file, line, function and level), passed to the logger as the last argument and registered
+// the first time it is reached, so that it can be enabled or disabled at runtime (see CallSiteRegistry).
+// The state of the call site (or by default, the level of the logger) is checked first, so that the arguments are only evaluated if the message is written.
 //
 
+// Defines the static call site "sbloggerCallSite" of a logging macro of "level"
+#define SBLOGGER_CALL_SITE(level)						static const sblogger::CallSite sbloggerCallSite{ __FILE__, sblogger::detail::sourceFileName(__FILE__, __FILE__), \
+															__LINE__, __func__, level, { sblogger::CallSiteState::UNREGISTERED } }
+
+// Calls "method" of logger "x" with the call site info (regardless of its level, which is given by the arguments)
+#define SBLOGGER_LOG(x, method, ...)					do { SBLOGGER_CALL_SITE(sblogger::LogLevel::TRACE); (x).method(__VA_ARGS__, &sbloggerCallSite); } while (0)
+
+// Calls "method" of logger "x" with the call site info, if messages of the call site are enabled
+#define SBLOGGER_LOG_IF_ENABLED(x, level, method, ...)	do { SBLOGGER_CALL_SITE(level); auto& sbloggerMacroLogger = (x); if (SBLOGGER_UNLIKELY(sbloggerMacroLogger.IsEnabled(sbloggerCallSite))) \
+															sbloggerMacroLogger.method(__VA_ARGS__, &sbloggerCallSite); } while (0)
+
 #if defined SBLOGGER_LOG_LEVEL && SBLOGGER_LOG_LEVEL < SBLOGGER_LEVEL_OFF
 	#if SBLOGGER_LOG_LEVEL <= SBLOGGER_LEVEL_TRACE
-		#define SBLOGGER_WRITE(x, ...)			x.Write(__VA_ARGS__, "__MACROS__", __FILE__, __LINE__, __func__)
-		#define SBLOGGER_WRITELINE(x, ...)		x.WriteLine(__VA_ARGS__, "__MACROS__", __FILE__, __LINE__, __func__)
-		#define SBLOGGER_TRACE(x, ...)			x.Trace(__VA_ARGS__, "__MACROS__", __FILE__, __LINE__, __func__)
+		#define SBLOGGER_WRITE(x, ...)			SBLOGGER_LOG(x, Write, __VA_ARGS__)
+		#define SBLOGGER_WRITELINE(x, ...)		SBLOGGER_LOG(x, WriteLine, __VA_ARGS__)
+		#define SBLOGGER_TRACE(x, ...)			SBLOGGER_LOG_IF_ENABLED(x, sblogger::LogLevel::TRACE, Trace, __VA_ARGS__)
 	#else
 		#define SBLOGGER_WRITE(x, ...)
 		#define SBLOGGER_WRITELINE(x, ...)
@@ -1728,31 +8077,31 @@ namespace sblogger
 	#endif
 
 	#if SBLOGGER_LOG_LEVEL <= SBLOGGER_LEVEL_DEBUG
-		#define SBLOGGER_DEBUG(x, ...)			x.Debug(__VA_ARGS__, "__MACROS__", __FILE__, __LINE__, __func__)
+		#define SBLOGGER_DEBUG(x, ...)			SBLOGGER_LOG_IF_ENABLED(x, sblogger::LogLevel::DEBUG, Debug, __VA_ARGS__)
 	#else
 		#define SBLOGGER_DEBUG(x, ...)
 	#endif
 
 	#if SBLOGGER_LOG_LEVEL <= SBLOGGER_LEVEL_INFO
-		#define SBLOGGER_INFO(x, ...)			x.Info(__VA_ARGS__, "__MACROS__", __FILE__, __LINE__, __func__)
+		#define SBLOGGER_INFO(x, ...)			SBLOGGER_LOG_IF_ENABLED(x, sblogger::LogLevel::INFO, Info, __VA_ARGS__)
 	#else
 		#define SBLOGGER_INFO(x, ...)
 	#endif
 
 	#if SBLOGGER_LOG_LEVEL <= SBLOGGER_LEVEL_WARN
-		#define SBLOGGER_WARN(x, ...)			x.Warn(__VA_ARGS__, "__MACROS__", __FILE__, __LINE__, __func__)
+		#define SBLOGGER_WARN(x, ...)			SBLOGGER_LOG_IF_ENABLED(x, sblogger::LogLevel::WARN, Warn, __VA_ARGS__)
 	#else
 		#define SBLOGGER_WARN(x, ...)
 	#endif
 
 	#if SBLOGGER_LOG_LEVEL <= SBLOGGER_LEVEL_ERROR
-		#define SBLOGGER_ERROR(x, ...)			x.Error(__VA_ARGS__, "__MACROS__", __FILE__, __LINE__, __func__)
+		#define SBLOGGER_ERROR(x, ...)			SBLOGGER_LOG_IF_ENABLED(x, sblogger::LogLevel::ERROR, Error, __VA_ARGS__)
 	#else
 		#define SBLOGGER_ERROR(x, ...)
 	#endif
 
 	#if SBLOGGER_LOG_LEVEL <= SBLOGGER_LEVEL_CRITICAL
-		#define SBLOGGER_CRITICAL(x, ...)		x.Critical(__VA_ARGS__, "__MACROS__", __FILE__, __LINE__, __func__)
+		#define SBLOGGER_CRITICAL(x, ...)		SBLOGGER_LOG_IF_ENABLED(x, sblogger::LogLevel::CRITICAL, Critical, __VA_ARGS__)
 	#else
 		#define SBLOGGER_CRITICAL(x, ...)
 	#endif
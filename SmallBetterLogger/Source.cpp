@@ -23,7 +23,7 @@ int main()
 	l.WriteLine(std::string("Hello, {0}!"), "World");	// Message to be writen can also be a variable of type std::string
 	l.Dedent();											// Remove indent at any time from the logger
 
-	l.Write("I am {0} and {1} years old.{2} {0}", "Michael", 28);	// If you give more placeholders than parameters, they are just writen as is
+	l.Write(std::string("I am {0} and {1} years old.{2} {0}"), "Michael", 28);	// If you give more placeholders than parameters, they are just writen as is (string literals are checked at compile time in C++20)
 	l.Write("{0}", "\n", "hey");									// If you give more parameters, they are just ignored
 
 	logErr.WriteLine("stderr");
@@ -0,0 +1,210 @@
+// sblog-decode: converts the binary log files written by FileLoggers (see FileLogger::SetBinary) back to text
+//
+// Usage: sblog-decode [options] [file...]
+//	-f, --format <format>	format the messages with <format> (using the log format syntax), instead of the format they were written with
+//	-l, --level <level>		only write the messages of <level> or higher (trace, debug, info, warn, error or critical)
+//	--from <time>			only write the messages written at <time> or later ("YYYY-MM-DD HH:MM:SS" or "YYYY-MM-DD", local time)
+//	--to <time>				only write the messages written before <time>
+//
+// The files are read in order, the standard input being read if none (or "-") is given, so compressed files can be read through "lz4 -dc" or "gzip -dc"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <ctime>
+#include <cctype>
+#include <cstdlib>
+
+// Used for reading the standard input in binary mode
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#endif
+
+#include "../SmallBetterLogger/SmallBetterLogger.hpp"
+
+// Options given on the command line
+struct Options
+{
+	std::string format;
+	sblogger::LogLevel level;
+	std::chrono::system_clock::time_point from;
+	std::chrono::system_clock::time_point to;
+	std::vector<std::string> files;
+};
+
+// Writes the usage of the tool to "stream"
+static void writeUsage(std::ostream& stream)
+{
+	stream << "Usage: sblog-decode [options] [file...]\n"
+		"  -f, --format <format>  format the messages with <format>, instead of the format they were written with\n"
+		"  -l, --level <level>    only write the messages of <level> or higher (trace, debug, info, warn, error or critical)\n"
+		"  --from <time>          only write the messages written at <time> or later (\"YYYY-MM-DD HH:MM:SS\" or \"YYYY-MM-DD\", local time)\n"
+		"  --to <time>            only write the messages written before <time>\n"
+		"Reads the standard input if no file (or \"-\") is given.\n";
+}
+
+// Parses the name of a log level (case insensitive), returns false if it is not one
+static bool parseLevel(std::string name, sblogger::LogLevel& level)
+{
+	static const char* names[]{ "trace", "debug", "info", "warn", "error", "critical" };
+
+	for (char& character : name)
+		character = static_cast<char>(std::tolower(static_cast<unsigned char>(character)));
+	for (size_t i = 0u; i < sizeof(names) / sizeof(names[0]); ++i)
+		if (name == names[i])
+		{
+			level = static_cast<sblogger::LogLevel>(i);
+			return true;
+		}
+
+	return false;
+}
+
+// Parses a local time ("YYYY-MM-DD HH:MM:SS", "YYYY-MM-DDTHH:MM:SS" or "YYYY-MM-DD"), returns false if it is not one
+static bool parseTime(const std::string& text, std::chrono::system_clock::time_point& time)
+{
+	static const char* formats[]{ "%Y-%m-%d %H:%M:%S", "%Y-%m-%dT%H:%M:%S", "%Y-%m-%d" };
+
+	for (const char* format : formats)
+	{
+		std::tm date{};
+		std::istringstream stream(text);
+
+		stream >> std::get_time(&date, format);
+		if (stream.fail() || stream.peek() != std::char_traits<char>::eof())
+			continue;
+
+		date.tm_isdst = -1;
+		const std::time_t seconds = std::mktime(&date);
+		if (seconds == static_cast<std::time_t>(-1))
+			return false;
+
+		time = std::chrono::system_clock::from_time_t(seconds);
+		return true;
+	}
+
+	return false;
+}
+
+// Parses the command line into "options", returns false (after writing the error) if it is not valid
+static bool parseOptions(int argc, char* argv[], Options& options)
+{
+	options.level = sblogger::LogLevel::TRACE;
+	options.from = std::chrono::system_clock::time_point::min();
+	options.to = std::chrono::system_clock::time_point::max();
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string argument(argv[i]);
+		const bool hasValue = i + 1 < argc;
+
+		if (argument == "-h" || argument == "--help")
+		{
+			writeUsage(std::cout);
+			std::exit(0);
+		}
+		else if ((argument == "-f" || argument == "--format") && hasValue)
+			options.format = argv[++i];
+		else if ((argument == "-l" || argument == "--level") && hasValue)
+		{
+			if (!parseLevel(argv[++i], options.level))
+			{
+				std::cerr << "sblog-decode: unknown level " << argv[i] << '\n';
+				return false;
+			}
+		}
+		else if ((argument == "--from" || argument == "--to") && hasValue)
+		{
+			if (!parseTime(argv[++i], argument == "--from" ? options.from : options.to))
+			{
+				std::cerr << "sblog-decode: invalid time " << argv[i] << '\n';
+				return false;
+			}
+		}
+		else if (argument.size() > 1u && argument[0] == '-')
+		{
+			std::cerr << "sblog-decode: invalid option " << argument << '\n';
+			writeUsage(std::cerr);
+			return false;
+		}
+		else
+			options.files.push_back(argument);
+	}
+
+	if (options.files.empty())
+		options.files.push_back("-");
+
+	return true;
+}
+
+// Writes the messages of "input" selected by "options" to the standard output, returns false if the input cannot be read
+static bool decode(std::istream& input, const std::string& name, const Options& options)
+{
+	sblogger::BinaryLogReader reader(input, options.format);
+	std::string output;
+
+	try
+	{
+		while (reader.Next())
+		{
+			if (reader.GetLevel() < options.level || reader.GetTime() < options.from || reader.GetTime() >= options.to)
+				continue;
+
+			output.clear();
+			reader.Format(output);
+			std::cout.write(output.data(), static_cast<std::streamsize>(output.size()));
+		}
+	}
+	catch (const sblogger::SBLoggerException& exception)
+	{
+		std::cout.flush();
+		std::cerr << "sblog-decode: " << name << ": " << exception.what() << '\n';
+		return false;
+	}
+
+	if (reader.IsTruncated())
+	{
+		std::cout.flush();
+		std::cerr << "sblog-decode: " << name << ": ends with an incomplete message\n";
+	}
+
+	return true;
+}
+
+int main(int argc, char* argv[])
+{
+	Options options;
+	int status = 0;
+
+	if (!parseOptions(argc, argv, options))
+		return 2;
+
+#ifdef _WIN32
+	_setmode(_fileno(stdin), _O_BINARY);
+#endif
+	std::ios::sync_with_stdio(false);
+
+	for (const std::string& file : options.files)
+	{
+		if (file == "-")
+		{
+			if (!decode(std::cin, "<stdin>", options))
+				status = 1;
+			continue;
+		}
+
+		std::ifstream input(file, std::ios::binary);
+		if (!input.is_open())
+		{
+			std::cerr << "sblog-decode: cannot open " << file << '\n';
+			status = 1;
+		}
+		else if (!decode(input, file, options))
+			status = 1;
+	}
+
+	return status;
+}
\ No newline at end of file